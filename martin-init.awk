@@ -0,0 +1,106 @@
+#-
+# Copyright (c) 2022 Hans Petter Selasky. All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions
+# are met:
+# 1. Redistributions of source code must retain the above copyright
+#    notice, this list of conditions and the following disclaimer.
+# 2. Redistributions in binary form must reproduce the above copyright
+#    notice, this list of conditions and the following disclaimer in the
+#    documentation and/or other materials provided with the distribution.
+#
+# THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+# ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+# ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+# OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+# HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+# LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+# OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+# SUCH DAMAGE.
+#
+
+#
+# Generate the init sequence table, martin_init.h, from a capture file
+# in the format described in martin-init.txt. All payloads are packed
+# into one read-only blob which the requests refer to by offset.
+# Identical payloads are stored only once.
+#
+
+function fail(msg) {
+	printf("%s:%d: %s\n", FILENAME, FNR, msg) > "/dev/stderr"
+	error = 1
+	exit 1
+}
+
+BEGIN {
+	num = 0
+	size = 0
+	max = 1
+}
+
+/^[ \t]*(#|$)/ {
+	next
+}
+
+{
+	if (NF != 6)
+		fail("expected 6 fields")
+	for (i = 1; i != 6; i++) {
+		if ($i !~ /^[0-9A-Fa-f]+$/ || length($i) > (i < 3 ? 2 : 4))
+			fail("bad field " i)
+	}
+	data = ($6 == "-") ? "" : $6
+	if (data !~ /^([0-9A-Fa-f][0-9A-Fa-f])*$/)
+		fail("bad data")
+
+	data = toupper(data)
+	len = length(data) / 2
+	if (!(data in offset)) {
+		offset[data] = size
+		for (i = 0; i != len; i++)
+			blob[size++] = substr(data, 2 * i + 1, 2)
+	}
+	req[num++] = sprintf("\t{ 0x%s, 0x%s, 0x%s, 0x%s, 0x%s, %d, %d },",
+	    $1, $2, $3, $4, $5, len, offset[data])
+	if (len > max)
+		max = len
+	if (size > 65535)
+		fail("payload too large")
+}
+
+END {
+	if (error)
+		exit 1
+
+	print "/* This file is generated by martin-init.awk, do not edit. */"
+	print ""
+	print "#define\tSETUP_DATA_MAX " max
+	print ""
+	print "struct setup_request {"
+	print "\tuint8_t\tbmRequestType;"
+	print "\tuint8_t\tbRequest;"
+	print "\tuint16_t wValue;"
+	print "\tuint16_t wIndex;"
+	print "\tuint16_t wLength;"
+	print "\tuint16_t cbData;"
+	print "\tuint16_t offset;\t/* into s_setupData[] */"
+	print "};"
+	print ""
+	print "static const struct setup_request s_setupRequest[" num "] = {"
+	for (i = 0; i != num; i++)
+		print req[i]
+	print "};"
+	print ""
+	print "static const uint8_t s_setupData[" (size ? size : 1) "] = {"
+	for (i = 0; i < size; i += 12) {
+		line = "\t"
+		for (j = i; j != i + 12 && j != size; j++)
+			line = line (j == i ? "" : " ") "0x" blob[j] ","
+		print line
+	}
+	print "};"
+}
@@ -27,14 +27,48 @@
  * This file implements support for the DMX512 port via USB on Martin
  * Lightning products.
  */
+#ifdef __linux__
+#define	_GNU_SOURCE		/* CPU affinity */
+#endif
 
 #include <stdio.h>
 #include <stdint.h>
 #include <stdlib.h>
-#include <usb.h>
+#include <unistd.h>
+#include <time.h>
+#include <errno.h>
+#include <err.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <string.h>
+#include <math.h>
+#include <libusb.h>
 #include <pthread.h>
+#include <semaphore.h>
+#include <sched.h>
+#include <stdatomic.h>
 #include <alsa/asoundlib.h>
 
+#ifdef __FreeBSD__
+#include <sys/param.h>
+#include <sys/cpuset.h>
+#include <pthread_np.h>
+typedef cpuset_t cpu_set_t;
+#endif
+
+#include "martin-usb-dmx.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
 #ifdef HAVE_PICTURE
 #include "picture.h"
 #endif
@@ -42,27 +76,498 @@
 #define	USB_VENDOR 0x11be
 #define	USB_PRODUCT 0xf808
 
-#define	USB_RX_ENDPOINT 2
-#define	USB_TX_ENDPOINT 4
+#define	USB_RX_ENDPOINT (LIBUSB_ENDPOINT_IN | 2)
+#define	USB_RX_SIZE 1024
+#define	USB_RX_ERRORS 3		/* consecutive, before giving up */
+#define	USB_TX_ENDPOINT (LIBUSB_ENDPOINT_OUT | 4)
+#define	USB_TX_FRAMES 2		/* frames in flight */
+#define	USB_TX_TIMEOUT 1000	/* ms */
+#define	USB_PACKET_SIZE 530
+#define	USB_SETUP_TIMEOUT 1000	/* ms */
+#define	USB_SETUP_TIMEOUT_FAST 100	/* ms */
+#define	USB_SETUP_RETRY_FAST 3
+#define	USB_PORTS_MAX 7		/* USB 3.0 hub depth */
+#define	USB_RESCAN 1000000000ULL	/* ns, while a unit is unplugged */
+#define	USB_SETUP_LED_WRITE 0x61	/* vendor request, panel LED data */
 
 #define	NOTE_START (5 * 12)
 #define	NOTE_END (NOTE_START + 26)
 
-#define	FPS 10
+#define	DMX_SLOTS 512
+#define	DMX_SLOT_NONE DMX_SLOTS	/* sink for unpatched channels */
+
+#define	FPS 10			/* default frame rate */
+#define	FPS_MAX 44		/* DMX512 maximum for 512 slots */
+#define	FPS_MIN 1		/* lowest adapted rate */
 #define	LEDS 8
+#define	MAX_DEVICES 16		/* one DMX universe each */
+
+#define	EVENT_FDS_MAX (MAX_DEVICES + 16)	/* ALSA, network and LibUSB */
 
-static usb_dev_handle * usb_devh_rx;
-static usb_dev_handle * usb_devh_tx;
+#if MAX_DEVICES > MARTIN_STATS_UNITS
+#error "MAX_DEVICES is too big for the statistics page"
+#endif
+#if MAX_DEVICES > MARTIN_UNIVERSE_UNITS
+#error "MAX_DEVICES is too big for the universe page"
+#endif
+
+#define	UNIVERSE_RETRY 64	/* reads of a universe while it is written */
+#define	SEQLOCK_RETRY 64	/* reads of the control and network state */
+#define	JOIN_SPIN 1000		/* polls at the frame join before yielding */
+
+static libusb_context *usb_ctx;
 static snd_seq_t *alsa_seq;
-#ifdef HAVE_PICTURE
-static const char *image_data;
-static uint32_t image_size;
-static uint32_t random_value;
+static unsigned frame_rate = FPS;
+static uint64_t frame_spacing;		/* ns, immediate mode only */
+static uint8_t frame_immediate;
+static uint8_t usb_tx_delta;
+static uint8_t usb_setup_fast;
+static unsigned usb_max_units = MAX_DEVICES;
+static uint64_t sampler_seed;
+static uint8_t dither;			/* spread the curve fraction over frames */
+static uint8_t frame_lockstep;		/* all units send on one frame grid */
+static uint64_t input_latency;		/* ns */
+static int alsa_queue = -1;
+static uint64_t alsa_queue_base;	/* CLOCK_MONOTONIC at queue time zero */
+
+/* scheduling of the time critical threads */
+static int rt_priority;			/* SCHED_FIFO priority of the writers, or 0 */
+static int rt_cpu_event = -1;		/* CPU of the event loop, or -1 */
+static int rt_cpu_writer[MAX_DEVICES];	/* CPUs of the writers, round robin */
+static unsigned rt_num_cpu_writer;
+static uint8_t rt_mlock;
+
+/* either private or mapped from a shared memory object, see stats_open() */
+static struct martin_stats stats_local;
+static struct martin_stats *stats = &stats_local;
+
+/* mapped from a shared memory object, see universe_open(), or NULL */
+static struct martin_universes *universes;
+
+/* set when LibUSB adds or removes a file descriptor */
+static atomic_int usb_pollfd_changed = 1;
+
+/*
+ * The pixel source is a sequence of RGB frames, either mapped from a
+ * binary PPM file or decoded from the compiled in picture at startup.
+ * Each LED samples one pixel at a precomputed offset from the current
+ * image position.
+ */
+static struct image {
+	const uint8_t *data;	/* first frame, 3 bytes per pixel */
+	size_t	stride;		/* bytes from one frame to the next */
+	uint32_t pixels;	/* per frame */
+	uint32_t width;
+	uint32_t height;
+	uint32_t frames;
+	uint32_t *sample;	/* pixel offset per LED, below "pixels" */
+}	image;
+
+/*
+ * The controller state is written by the event loop only and read by
+ * the USB write thread only. It is exchanged through a sequence lock,
+ * so that the writer always renders one consistent snapshot without
+ * taking a lock.
+ */
+struct control {
+	float	decay;
+	float	led_gain;
+	float	spot_gain;
+	float	pixel_speed;
+	float	effect_bpm;
+	uint8_t	effect_wave;	/* WAVE_XXX */
+	uint8_t	effect_depth;	/* 0..255 */
+	uint8_t	effect_spread;	/* phase step per fixture, 1/128 cycle */
+	uint8_t	effect_sync;	/* incremented on MIDI start */
+};
+
+/*
+ * The effect engine runs a chase over the intensity of all fixtures.
+ * Each fixture reads a precomputed waveform at its own phase offset,
+ * and the result is merged highest takes precedence with the LED
+ * output. The phase advances with the tempo, which follows the MIDI
+ * clock when there is one.
+ */
+#define	WAVE_BITS 8
+#define	WAVE_SIZE (1U << WAVE_BITS)	/* entries per cycle */
+#define	WAVE_RANDOM_STEPS 16	/* random levels per cycle */
+#define	EFFECT_BPM 120		/* default tempo */
+#define	MIDI_CLOCK_PPQN 24
+
+enum {
+	WAVE_OFF,
+	WAVE_SINE,
+	WAVE_SAW,
+	WAVE_SQUARE,
+	WAVE_RANDOM,
+	WAVE_MAX,
+};
+
+static uint8_t wave_table[WAVE_MAX][WAVE_SIZE];
+
+/*
+ * Note triggers are passed from the event loop to the USB write thread
+ * through a single-producer, single-consumer ring. Each trigger carries
+ * the time it is due, and is applied to the first frame whose deadline
+ * is not before that time. The input is in time order, so the writer
+ * only has to look at the oldest entry.
+ */
+#define	TRIGGER_QUEUE 256		/* power of two */
+
+struct trigger_event {
+	uint64_t when;		/* CLOCK_MONOTONIC, ns */
+	uint16_t which;
+	uint8_t	velocity;
+};
+
+enum {
+	CH_I,			/* intensity */
+	CH_R,
+	CH_G,
+	CH_B,
+	CH_MAX,
+};
+
+/*
+ * Response curves map the output of the render kernel, CURVE_BITS
+ * wide, to DMX levels in 8.8 fixed point. The fraction is kept for the
+ * dithering. Curve 0 is always linear.
+ */
+#define	CURVE_BITS 12
+#define	CURVE_SIZE (1U << CURVE_BITS)
+#define	CURVE_TOP ((int)CURVE_SIZE - 1)	/* signed, for the scalar kernels */
+#define	CURVE_ONE (255U << 8)
+#define	CURVE_MAX 16
+#define	CURVE_POINTS 33		/* of a table curve */
+
+enum {
+	CURVE_LINEAR,
+	CURVE_GAMMA,
+	CURVE_SCURVE,
+	CURVE_TABLE,
+};
+
+struct led_map {
+	uint16_t offset[CH_MAX];
+	uint16_t fine[CH_MAX];	/* low byte of a 16-bit channel, if any */
+	uint8_t	curve[CH_MAX];
+	int32_t	pixel;		/* image pixel to sample, -1 for default */
+};
+
+enum {
+	CC_NONE,
+	CC_DECAY,
+	CC_LED_GAIN,
+	CC_SPOT_GAIN,
+	CC_PIXEL_SPEED,
+	CC_EFFECT_BPM,
+	CC_EFFECT_DEPTH,
+	CC_EFFECT_SPREAD,
+};
+
+/*
+ * Bytes of the packets received from the M-Touch panel are mapped to
+ * note and controller numbers, which then go through the same bindings
+ * as MIDI input. The layout of the packets depends on the firmware, so
+ * there are no built in mappings.
+ */
+enum {
+	PANEL_FADER,		/* absolute, 0..255 */
+	PANEL_BUTTON,		/* one bit, note-on when set */
+	PANEL_ENCODER,		/* signed step */
+};
+
+#define	PANEL_MAX 64
+
+struct panel_map {
+	uint16_t byte;
+	uint8_t	kind;		/* PANEL_XXX */
+	uint8_t	bit;
+	uint8_t	target;		/* note or controller number */
+};
+
+/*
+ * The fixture patch, either built in or loaded at startup. All lookups
+ * done per event are plain table lookups.
+ */
+struct patch {
+	struct led_map *led;
+	unsigned num_leds;
+	uint16_t note[128];	/* LED index plus one, zero if unused */
+	uint8_t	effect[128];	/* WAVE_XXX plus one, zero if unused */
+	uint8_t	cc[128];	/* CC_XXX */
+	uint16_t spot_start;
+	uint16_t spot_end;
+	struct panel_map panel[PANEL_MAX];
+	unsigned num_panel;
+	uint16_t (*curve)[CURVE_SIZE];
+	unsigned num_curve;
+};
+
+/*
+ * Network DMX input. Art-Net and sACN (E1.31) universes are received by
+ * the event loop and mapped to the units in order, starting at a
+ * configurable universe number. Up to NET_SOURCES senders per universe
+ * are merged, either highest takes precedence (HTP), among the sACN
+ * sources of the highest priority, or latest takes precedence (LTP).
+ */
+#define	ARTNET_PORT 6454
+#define	ARTNET_TIMEOUT 10000000000ULL	/* ns, merge timeout */
+#define	SACN_PORT 5568
+#define	SACN_TIMEOUT 2500000000ULL	/* ns, data loss timeout */
+#define	NET_BATCH 16			/* datagrams per recvmmsg() */
+#define	NET_PACKET_MAX 638		/* E1.31 data packet of 512 slots */
+#define	NET_SOURCES 4
+
+enum {
+	NET_ARTNET,
+	NET_SACN,
+	NET_MAX,
+};
+
+enum {
+	NET_HTP,
+	NET_LTP,
+};
+
+struct net_source {
+	uint8_t	id[16];		/* sACN CID or Art-Net sender address */
+	uint64_t serial;	/* of the last packet, for LTP */
+	uint64_t expire;	/* ns, zero if unused */
+	uint8_t	priority;
+	uint8_t	data[DMX_SLOTS];
+};
+
+static int net_universe[NET_MAX] = { -1, -1 };	/* of the first unit, or -1 */
+static uint8_t net_merge = NET_HTP;
+
+/*
+ * Output recorder. The writers pass each packet they submit through a
+ * single-producer, single-consumer ring per unit to the recorder
+ * thread, which appends it to the file in time order. The file starts
+ * with RECORD_MAGIC, followed by one record per packet:
+ *
+ *	varint	time since the previous record, in microseconds
+ *	byte	unit
+ *	varint	packet length
+ *	runs	until the length is covered, each being a varint count of
+ *		bytes equal to the previous packet of the unit, a varint
+ *		count of literal bytes, and the literal bytes
+ *
+ * Varints are 7 bits per byte, least significant first, with bit 7
+ * set on all bytes but the last.
+ */
+#define	RECORD_MAGIC "MDXR\001\000\000\000"
+#define	RECORD_QUEUE 64			/* packets per unit, power of two */
+#define	RECORD_INTERVAL 50000000ULL	/* ns, between file writes */
+#define	RECORD_HOLD 20000000ULL		/* ns, allowance for late packets */
+#define	RECORD_RUN_MIN 3		/* equal bytes worth a new run */
+
+struct record_frame {
+	uint64_t when;		/* ns */
+	uint16_t length;
+	uint8_t	data[USB_PACKET_SIZE];
+};
+
+static FILE *record_file;
+static const char *replay_file;
+static uint8_t replay_fast;
+
+/*
+ * Envelope levels are floats from 0 to 1 or, when built with
+ * HAVE_FIXED_POINT, Q15 integers from 0 to LEVEL_ONE. The fixed point
+ * engine is cheaper on small ARM boards and gives the same DMX values
+ * within one step.
+ */
+#ifdef HAVE_FIXED_POINT
+typedef int16_t level_t;
+#define	LEVEL_ONE 32767
+#define	LEVEL(f) ((level_t)((f) * LEVEL_ONE + 0.5f))
+#define	LEVEL_PIXEL(p) (((p) << 7) + ((p) >> 1))	/* p * LEVEL_ONE / 255 */
+#define	LEVEL_PIXEL3(s) (((s) * 21931) >> 9)		/* s * LEVEL_ONE / 765 */
+#define	LEDS_ALIGN 8
+#else
+typedef float level_t;
+#define	LEVEL_ONE 1.0f
+#define	LEVEL(f) (f)
+#define	LEVEL_PIXEL(p) ((p) / 255.0f)
+#define	LEVEL_PIXEL3(s) ((s) / (255.0f * 3.0f))
+#define	LEDS_ALIGN 4
 #endif
-static float global_decay = 3.0;
-static float global_led_gain = 0;
-static float global_spot_gain = 0;
-static float global_pixel_speed = 0;
+
+/*
+ * The LED envelopes are kept as a structure of arrays, one array per
+ * channel, padded to a multiple of LEDS_ALIGN entries, so that the
+ * render kernel can process several LEDs per instruction.
+ */
+struct leds {
+	unsigned num;
+	unsigned stride;	/* num rounded up to LEDS_ALIGN */
+	level_t	*value[CH_MAX];
+	level_t	*target[CH_MAX];
+	uint16_t *out[CH_MAX];	/* curve index */
+	uint16_t *effect;	/* curve index, intensity only */
+	uint16_t *offset[CH_MAX];
+	uint16_t *fine[CH_MAX];
+	uint8_t	*curve[CH_MAX];
+};
+
+struct martin_dev;
+
+struct usb_tx {
+	struct martin_dev *dev;
+	struct libusb_transfer *xfer;
+	uint64_t submitted;	/* ns */
+	uint64_t event;		/* ns, oldest input event in this frame or 0 */
+	uint8_t	busy;
+	uint8_t	data[USB_PACKET_SIZE];
+};
+
+/*
+ * Life cycle of a unit. An unplugged unit keeps its state and its
+ * threads, and takes over the next interface which is plugged in,
+ * preferably at the same port.
+ */
+enum {
+	UNIT_RUNNING,
+	UNIT_SETUP,		/* init sequence in progress */
+	UNIT_CLOSING,		/* waiting for the transfers to finish */
+	UNIT_DETACHED,
+};
+
+/*
+ * Each Martin USB DMX interface drives one DMX universe and has its own
+ * state, its own ALSA sequencer port and its own write thread. Reads
+ * and transfer completions are handled by the common event loop.
+ */
+struct martin_dev {
+	unsigned unit;
+	int	alsa_port;
+	libusb_device_handle *devh;
+	struct martin_stats_unit *stats;
+
+	/* time of the oldest input event not yet sent, or 0 */
+	_Atomic uint64_t event;
+
+	/* transmit state, shared with the event loop */
+	pthread_mutex_t tx_mtx;
+	struct usb_tx tx[USB_TX_FRAMES];
+	unsigned tx_next;
+	uint64_t tx_time;	/* ns, average submit to completion */
+	unsigned tx_lost;	/* frames which failed, never reset */
+	uint8_t	tx_errors;
+	uint8_t	tx_attached;	/* clear while unplugged */
+	uint8_t	null_backend;	/* no interface, frames are discarded */
+
+	/* hot plug state, owned by the event loop */
+	uint8_t	state;		/* UNIT_XXX */
+	uint8_t	gone;		/* a transfer saw the device disappear */
+	struct {
+		uint8_t	bus;
+		uint8_t	num;
+		uint8_t	path[USB_PORTS_MAX];
+	}	port;
+	struct {
+		struct libusb_transfer *xfer;
+		uint64_t start;	/* ns */
+		unsigned next;	/* request of the init sequence */
+		uint8_t	retry;
+		uint8_t	active;
+		uint8_t	*data;
+	}	setup;
+
+	/* receive state, owned by the event loop */
+	struct {
+		struct libusb_transfer *xfer;
+		uint8_t	active;
+		uint8_t	errors;
+		uint8_t	data[USB_RX_SIZE];
+		uint8_t	last[USB_RX_SIZE];	/* previous packet */
+	}	rx;
+
+	/* immediate mode wakeup */
+	pthread_mutex_t frame_mtx;
+	pthread_cond_t frame_cond;
+	uint8_t	frame_wakeup;
+
+	struct {
+		atomic_uint seq;
+		struct control data;
+	}	control;
+
+	struct {
+		atomic_uint head;
+		atomic_uint tail;
+		struct trigger_event ev[TRIGGER_QUEUE];
+	}	trigger;
+
+	/* submitted packets, only allocated when recording */
+	struct {
+		atomic_uint head;
+		atomic_uint tail;
+		struct record_frame *frame;
+		uint8_t	last[USB_PACKET_SIZE];	/* owned by the recorder */
+	}	record;
+
+	/* merged network DMX, a sequence lock like "control" */
+	struct {
+		atomic_uint seq;
+		uint8_t	active;
+		uint8_t	data[DMX_SLOTS];
+	}	net;
+
+	/* owned by the event loop */
+	struct control alsa_ctl;
+	uint8_t	cc_value[128];	/* last value per controller */
+	struct {
+		uint64_t beat;	/* ns, last quarter note */
+		uint32_t count;
+	}	clock;
+	struct {
+		uint64_t when;	/* ns, first event of the batch */
+		uint8_t	pending;
+		uint8_t	publish;
+		uint8_t	wake;
+		uint8_t	net;
+	}	input;
+	struct net_source net_source[NET_SOURCES];
+
+	/* owned by the USB write thread */
+	struct leds leds;
+	struct sampler {
+		uint64_t state;	/* xorshift64* */
+		uint32_t pos;	/* pixel, below image.pixels */
+		uint32_t step;	/* pixels, below image.pixels */
+	}	sampler;
+	uint32_t image_frame;
+	uint32_t dither_frame;
+	struct {
+		uint64_t period;	/* ns, adapted to the bus */
+		uint64_t good;		/* ns, uncongested since */
+		uint8_t	congested;
+	}	adapt;
+	struct {
+		struct martin_universe *map;	/* or NULL */
+		unsigned seq;		/* of "data", odd if none */
+		uint8_t	data[DMX_SLOTS];	/* last complete frame */
+	}	universe;
+	struct control control_last;	/* last complete snapshot */
+	struct {
+		unsigned seq;		/* of "data", odd if none */
+		uint8_t	active;
+		uint8_t	data[DMX_SLOTS];	/* last complete frame */
+	}	net_last;
+	struct {
+		uint64_t last;	/* ns, previous frame */
+		uint32_t phase;	/* one cycle per 2**32 */
+		uint8_t	sync;
+		uint8_t	idle;
+	}	effect;
+};
+
+static struct martin_dev *martin_dev[MAX_DEVICES];
+static unsigned martin_num;
+static struct patch patch;
 
 static const uint8_t midi_map[26] = {
 	/* 1st octave */
@@ -103,23 +608,18 @@ static const uint8_t midi_map[26] = {
 #define	SPOT_START 0
 #define	SPOT_END 20
 
-static struct {
-	uint16_t offset_i;
-	uint16_t offset_r;
-	uint16_t offset_g;
-	uint16_t offset_b;
-
-	float	value_i;
-	float	value_r;
-	float	value_g;
-	float	value_b;
-}	led_map[LEDS] = {
-#define	LED_MAP(offset) { \
-    .offset_i = (offset) + 7, \
-    .offset_r = (offset) + 0, \
-    .offset_g = (offset) + 1, \
-    .offset_b = (offset) + 2 \
-}
+static const struct led_map led_map[LEDS] = {
+#define	LED_MAP(base) { .offset = { \
+    [CH_I] = (base) + 7, \
+    [CH_R] = (base) + 0, \
+    [CH_G] = (base) + 1, \
+    [CH_B] = (base) + 2 \
+}, .fine = { \
+    [CH_I] = DMX_SLOT_NONE, \
+    [CH_R] = DMX_SLOT_NONE, \
+    [CH_G] = DMX_SLOT_NONE, \
+    [CH_B] = DMX_SLOT_NONE \
+}, .pixel = -1 }
 
 	LED_MAP(99),
 	LED_MAP(108),
@@ -133,16 +633,73 @@ static struct {
 };
 
 static void
-trigger(uint8_t which, uint8_t velocity)
+control_publish(struct martin_dev *dev, const struct control *ctl)
+{
+	unsigned seq = atomic_load_explicit(&dev->control.seq, memory_order_relaxed);
+
+	atomic_store_explicit(&dev->control.seq, seq + 1, memory_order_relaxed);
+	atomic_thread_fence(memory_order_release);
+	dev->control.data = *ctl;
+	atomic_store_explicit(&dev->control.seq, seq + 2, memory_order_release);
+}
+
+/*
+ * The writer may run under SCHED_FIFO on the CPU of the event loop, and
+ * then the publisher cannot finish while the writer spins. The number
+ * of reads is therefore bounded, and the last complete snapshot is used
+ * after that.
+ */
+static void
+control_snapshot(struct martin_dev *dev, struct control *ctl)
+{
+	struct control data;
+	unsigned seq;
+
+	for (unsigned x = 0; x != SEQLOCK_RETRY; x++) {
+		seq = atomic_load_explicit(&dev->control.seq, memory_order_acquire);
+		if (seq & 1)
+			continue;
+		data = dev->control.data;
+		atomic_thread_fence(memory_order_acquire);
+		if (atomic_load_explicit(&dev->control.seq, memory_order_relaxed) != seq)
+			continue;
+		dev->control_last = data;
+		break;
+	}
+	*ctl = dev->control_last;
+}
+
+static int
+trigger_enqueue(struct martin_dev *dev, uint16_t which, uint8_t velocity, uint64_t when)
+{
+	unsigned head = atomic_load_explicit(&dev->trigger.head, memory_order_relaxed);
+	unsigned tail = atomic_load_explicit(&dev->trigger.tail, memory_order_acquire);
+
+	if (head - tail == TRIGGER_QUEUE)
+		return (-1);	/* queue full */
+
+	dev->trigger.ev[head % TRIGGER_QUEUE] = (struct trigger_event){
+		.when = when,
+		.which = which,
+		.velocity = velocity,
+	};
+	atomic_store_explicit(&dev->trigger.head, head + 1, memory_order_release);
+	return (0);
+}
+
+static void
+trigger(struct martin_dev *dev, uint16_t which, uint8_t velocity)
 {
-	if (which >= LEDS)
+	struct leds *leds = &dev->leds;
+
+	if (which >= leds->num)
 		return;
 	velocity = 127 - velocity;
 
-	led_map[which].value_i = (led_map[which].value_i * velocity) / 127.0;
-	led_map[which].value_r = 1.0;
-	led_map[which].value_g = 0.0;
-	led_map[which].value_b = 0.0;
+	leds->value[CH_I][which] = leds->value[CH_I][which] * velocity / 127;
+	leds->value[CH_R][which] = LEVEL_ONE;
+	leds->value[CH_G][which] = 0;
+	leds->value[CH_B][which] = 0;
 }
 
 static void
@@ -155,257 +712,3848 @@ store(float value, uint8_t *ptr, float max)
 	*ptr = (int)(max * value);
 }
 
+/*
+ * Apply all triggers due at the given frame deadline.
+ */
 static void
-store_led(uint8_t which, uint8_t *ptr)
+trigger_dequeue(struct martin_dev *dev, uint64_t deadline)
 {
-	store(led_map[which].value_i * global_led_gain, ptr + led_map[which].offset_i, 255);
-	store(led_map[which].value_r, ptr + led_map[which].offset_r, 255);
-	store(led_map[which].value_g, ptr + led_map[which].offset_g, 255);
-	store(led_map[which].value_b, ptr + led_map[which].offset_b, 255);
-}
+	unsigned tail = atomic_load_explicit(&dev->trigger.tail, memory_order_relaxed);
+	unsigned head = atomic_load_explicit(&dev->trigger.head, memory_order_acquire);
 
-static void
-update(uint8_t which, float i, float r, float g, float b)
-{
-	led_map[which].value_i += (i - led_map[which].value_i) / global_decay;
-	led_map[which].value_r += (r - led_map[which].value_r) / global_decay;
-	led_map[which].value_g += (g - led_map[which].value_g) / global_decay;
-	led_map[which].value_b += (b - led_map[which].value_b) / global_decay;
+	for (; tail != head; tail++) {
+		const struct trigger_event *ev = &dev->trigger.ev[tail % TRIGGER_QUEUE];
+
+		if (ev->when > deadline)
+			break;
+		trigger(dev, ev->which, ev->velocity);
+	}
+	atomic_store_explicit(&dev->trigger.tail, tail, memory_order_release);
 }
 
-static void
-update_pixel_speed()
+static int
+leds_alloc(struct leds *leds, const struct led_map *map, unsigned num)
 {
-#ifdef HAVE_PICTURE
-	unsigned w_rand = (arc4random() % width) * global_pixel_speed;
-	unsigned h_rand = (arc4random() % height) * global_pixel_speed;
-	unsigned value = (w_rand + h_rand * width) % (image_size / 4);
+	const unsigned stride = (num + LEDS_ALIGN - 1) & ~(LEDS_ALIGN - 1);
+	const size_t size = CH_MAX * stride *
+	    (2 * sizeof(level_t) + 3 * sizeof(uint16_t) + sizeof(uint8_t)) +
+	    stride * sizeof(uint16_t);
+	uint8_t *ptr;
 
-	random_value = 4 * value;
-#endif
-}
+	if (posix_memalign((void **)&ptr, LEDS_ALIGN * sizeof(level_t), size) != 0)
+		return (-1);
+	memset(ptr, 0, size);
 
-static void *
-usb_read_loop(void *arg)
-{
-	uint8_t buffer[1024];
-	uint8_t timeout = 3;
+	leds->num = num;
+	leds->stride = stride;
 
-	while (1) {
-		if (usb_bulk_read(usb_devh_rx, USB_RX_ENDPOINT, (char *)buffer, sizeof(buffer), 0) < 0) {
-			if (timeout-- == 0)
-				break;
-		} else {
-			timeout = 3;
+	for (unsigned ch = 0; ch != CH_MAX; ch++) {
+		leds->value[ch] = (level_t *)ptr;
+		ptr += stride * sizeof(level_t);
+		leds->target[ch] = (level_t *)ptr;
+		ptr += stride * sizeof(level_t);
+	}
+	for (unsigned ch = 0; ch != CH_MAX; ch++) {
+		leds->out[ch] = (uint16_t *)ptr;
+		ptr += stride * sizeof(uint16_t);
+	}
+	leds->effect = (uint16_t *)ptr;
+	ptr += stride * sizeof(uint16_t);
+	for (unsigned ch = 0; ch != CH_MAX; ch++) {
+		leds->offset[ch] = (uint16_t *)ptr;
+		ptr += stride * sizeof(uint16_t);
+		leds->fine[ch] = (uint16_t *)ptr;
+		ptr += stride * sizeof(uint16_t);
+	}
+	for (unsigned ch = 0; ch != CH_MAX; ch++) {
+		leds->curve[ch] = ptr;
+		ptr += stride;
+	}
+	for (unsigned x = 0; x != num; x++) {
+		for (unsigned ch = 0; ch != CH_MAX; ch++) {
+			leds->offset[ch][x] = map[x].offset[ch];
+			leds->fine[ch][x] = map[x].fine[ch];
+			leds->curve[ch][x] = map[x].curve[ch];
 		}
 	}
-	printf("USB READ FAILED\n");
-	return (NULL);
+	return (0);
+}
+
+/*
+ * Decay "num" envelopes towards their targets and quantise the result
+ * times "gain" into curve indices. The "num" argument must be a
+ * multiple of LEDS_ALIGN and all arrays must be aligned accordingly.
+ */
+#ifdef HAVE_FIXED_POINT
+#if defined(__SSE2__)
+/*
+ * Multiply signed 16-bit lanes by the (factor, bias) pairs in "m" and
+ * shift right by 15, in 32-bit precision.
+ */
+static inline __m128i
+q15_madd(__m128i a, __m128i m)
+{
+	const __m128i one = _mm_set1_epi16(1);
+	const __m128i lo = _mm_srai_epi32(_mm_madd_epi16(_mm_unpacklo_epi16(a, one), m), 15);
+	const __m128i hi = _mm_srai_epi32(_mm_madd_epi16(_mm_unpackhi_epi16(a, one), m), 15);
+
+	return (_mm_packs_epi32(lo, hi));
 }
+#endif
 
+/*
+ * All variants round the same way, so that they give equal output:
+ * products round half up and (x * 4095 + 4095) >> 15 maps 0..LEVEL_ONE
+ * to the curve indices like the truncation of the float engine.
+ */
 static void
-convert(const uint8_t *from, uint8_t *to)
+render_kernel(level_t *value, const level_t *target, uint16_t *out,
+    unsigned num, level_t coeff, level_t gain)
 {
-	uint16_t c;
+#if defined(__SSE2__)
+	const __m128i c = _mm_set1_epi32((0x4000 << 16) | (uint16_t)coeff);
+	const __m128i g = _mm_set1_epi32((0x4000 << 16) | (uint16_t)gain);
+	const __m128i max = _mm_set1_epi32(((CURVE_SIZE - 1) << 16) | (CURVE_SIZE - 1));
+	const __m128i top = _mm_set1_epi16(CURVE_SIZE - 1);
+	const __m128i zero = _mm_setzero_si128();
 
-	for (c = 0; c != 512;) {
-		*to++ = c & 0xFF;
-		*to++ = c >> 8;
+	for (unsigned x = 0; x != num; x += 8) {
+		__m128i v = _mm_load_si128((const __m128i *)(value + x));
+		__m128i d = _mm_sub_epi16(_mm_load_si128((const __m128i *)(target + x)), v);
 
-		for (uint8_t x = 0; x != 62 && c != 512; x++, c++)
-			*to++ = *from++;
+		v = _mm_add_epi16(v, q15_madd(d, c));
+		_mm_store_si128((__m128i *)(value + x), v);
+
+		v = q15_madd(q15_madd(v, g), max);
+		v = _mm_min_epi16(_mm_max_epi16(v, zero), top);
+		_mm_store_si128((__m128i *)(out + x), v);
 	}
-}
+#elif defined(__ARM_NEON)
+	const int16x8_t c = vdupq_n_s16(coeff);
+	const int16x8_t g = vdupq_n_s16(gain);
+	const int32x4_t bias = vdupq_n_s32(CURVE_SIZE - 1);
+	const int16x8_t top = vdupq_n_s16(CURVE_SIZE - 1);
+	const int16x8_t zero = vdupq_n_s16(0);
 
-static void *
-usb_write_loop(void *arg)
-{
-	uint8_t buffer[512] = {};
-	uint8_t martin[530] = {};
-	uint8_t pixels[LEDS][3] = {};
-	uint32_t counter = 0;
-	uint8_t timeout = 3;
+	for (unsigned x = 0; x != num; x += 8) {
+		int16x8_t v = vld1q_s16(value + x);
+		int32x4_t lo;
+		int32x4_t hi;
 
-	while (1) {
-#ifdef HAVE_PICTURE
-		const char *image_ptr;
+		v = vaddq_s16(v, vqrdmulhq_s16(vsubq_s16(vld1q_s16(target + x), v), c));
+		vst1q_s16(value + x, v);
+
+		v = vqrdmulhq_s16(v, g);
+		lo = vmlal_n_s16(bias, vget_low_s16(v), CURVE_SIZE - 1);
+		hi = vmlal_n_s16(bias, vget_high_s16(v), CURVE_SIZE - 1);
+		v = vcombine_s16(vshrn_n_s32(lo, 15), vshrn_n_s32(hi, 15));
+		v = vminq_s16(vmaxq_s16(v, zero), top);
+		vst1q_u16(out + x, vreinterpretq_u16_s16(v));
+	}
+#else
+	for (unsigned x = 0; x != num; x++) {
+		int32_t v = value[x] + (((target[x] - value[x]) * coeff + 0x4000) >> 15);
+
+		value[x] = v;
+		v = (((v * gain + 0x4000) >> 15) * CURVE_TOP + CURVE_TOP) >> 15;
+		out[x] = (v < 0) ? 0 : (v > CURVE_TOP) ? CURVE_TOP : v;
+	}
 #endif
-		convert(buffer, martin);
+}
+#else
+static void
+render_kernel(level_t *value, const level_t *target, uint16_t *out,
+    unsigned num, level_t coeff, level_t gain)
+{
+#if defined(__SSE2__)
+	const __m128 c = _mm_set1_ps(coeff);
+	const __m128 g = _mm_set1_ps(gain);
+	const __m128 zero = _mm_setzero_ps();
+	const __m128 one = _mm_set1_ps(1.0f);
+	const __m128 max = _mm_set1_ps(CURVE_SIZE - 1);
 
-		if (usb_bulk_write(usb_devh_tx, USB_TX_ENDPOINT, (char *)martin, sizeof(martin), 0) < 0) {
-			if (timeout-- == 0)
-				break;
-		} else {
-			timeout = 3;
-		}
+	for (unsigned x = 0; x != num; x += 4) {
+		__m128 v = _mm_load_ps(value + x);
+		__m128i q;
 
-		usleep(1000000 / FPS);
+		v = _mm_add_ps(v, _mm_mul_ps(_mm_sub_ps(_mm_load_ps(target + x), v), c));
+		_mm_store_ps(value + x, v);
 
-#ifdef HAVE_PICTURE
-		image_data += random_value;
-		while ((image_data - header_data) >= image_size)
-			image_data -= image_size;
-#endif
-		for (unsigned x = SPOT_START; x != SPOT_END; x++)
-			store(global_spot_gain, buffer + x, 255);
+		v = _mm_min_ps(_mm_max_ps(_mm_mul_ps(v, g), zero), one);
+		q = _mm_cvttps_epi32(_mm_mul_ps(v, max));
+		_mm_storel_epi64((__m128i *)(out + x), _mm_packs_epi32(q, q));
+	}
+#elif defined(__ARM_NEON)
+	const float32x4_t c = vdupq_n_f32(coeff);
+	const float32x4_t g = vdupq_n_f32(gain);
+	const float32x4_t zero = vdupq_n_f32(0.0f);
+	const float32x4_t one = vdupq_n_f32(1.0f);
+	const float32x4_t max = vdupq_n_f32(CURVE_SIZE - 1);
 
-#ifdef HAVE_PICTURE
-		image_ptr = image_data;
+	for (unsigned x = 0; x != num; x += 4) {
+		float32x4_t v = vld1q_f32(value + x);
 
-		for (unsigned x = 0; x != LEDS; x++) {
-			while ((image_ptr - header_data) >= image_size)
-				image_ptr -= image_size;
-			HEADER_PIXEL(image_ptr, pixels[x]);
+		v = vaddq_f32(v, vmulq_f32(vsubq_f32(vld1q_f32(target + x), v), c));
+		vst1q_f32(value + x, v);
 
-			update(x, (pixels[x][0] + pixels[x][1] + pixels[x][2]) / (255.0f * 3.0f),
-			    pixels[x][0] / 255.0f, pixels[x][1] / 255.0f, pixels[x][2] / 255.0f);
-			store_led(x, buffer);
-		}
-#endif
-		if (++counter == 30 * FPS) {
-			counter = 0;
-			update_pixel_speed();
-		}
+		v = vminq_f32(vmaxq_f32(vmulq_f32(v, g), zero), one);
+		vst1_u16(out + x, vmovn_u32(vcvtq_u32_f32(vmulq_f32(v, max))));
 	}
-	printf("USB WRITE FAILED\n");
-	return (NULL);
+#else
+	for (unsigned x = 0; x != num; x++) {
+		float v;
+
+		value[x] += (target[x] - value[x]) * coeff;
+		v = value[x] * gain;
+		out[x] = (v > 1.0f) ? CURVE_TOP :
+		    (v < 0.0f) ? 0 : (int)(v * CURVE_TOP);
+	}
+#endif
 }
+#endif
 
+/*
+ * The image walk uses its own pseudo random generator, so that a show
+ * can be reproduced by passing the same seed.
+ */
 static void
-usb_martin_setup()
+sampler_init(struct sampler *smp, uint64_t seed)
+{
+	/* splitmix64, to spread similar seeds */
+	seed += 0x9E3779B97F4A7C15ULL;
+	seed = (seed ^ (seed >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	seed = (seed ^ (seed >> 27)) * 0x94D049BB133111EBULL;
+	seed ^= seed >> 31;
+
+	smp->state = seed ? seed : 1;
+	smp->pos = 0;
+	smp->step = 0;
+}
+
+static uint32_t
+sampler_random(struct sampler *smp, uint32_t range)
 {
-#include "martin.h"
+	uint64_t x = smp->state;
 
-	struct setup_request *req = s_setupRequest;
-	struct setup_request *end = s_setupRequest + (sizeof(s_setupRequest) / sizeof(*req));
+	x ^= x >> 12;
+	x ^= x << 25;
+	x ^= x >> 27;
+	smp->state = x;
 
-	for (; req != end; req++) {
-		char buffer[req->cbData];
-
-		if (usb_control_msg(usb_devh_rx,
-		    req->bmRequestType,
-		    req->bRequest,
-		    req->wValue,
-		    req->wIndex,
-		    (req->bmRequestType & 0x80) ? buffer : req->pData,
-		    req->cbData, 1000) < 0) {
-			printf("USB control request failed\n");
-			break;
-		}
-	}
+	/* scale to [0, range) without a division */
+	return (((x * 0x2545F4914F6CDD1DULL) >> 32) * range >> 32);
 }
 
-static void *
-alsa_read_loop(void *arg)
+/* Subtract "max" once if "value" is at or above it, without a branch. */
+static inline uint32_t
+sampler_wrap(uint32_t value, uint32_t max)
 {
-	snd_seq_event_t *ev;
+	return (value - (max & -(uint32_t)(value >= max)));
+}
 
-	while (snd_seq_event_input(alsa_seq, &ev) >= 0) {
-		switch (ev->type) {
-		case SND_SEQ_EVENT_NOTEON:
-			if (ev->data.note.channel != 0 ||
-			    ev->data.note.note < NOTE_START ||
-			    ev->data.note.note >= NOTE_END ||
-			    midi_map[ev->data.note.note - NOTE_START] == 0)
-				break;
-			trigger(midi_map[ev->data.note.note - NOTE_START] - 1, ev->data.note.velocity);
-			break;
-		case SND_SEQ_EVENT_CONTROLLER:
-#ifdef HAVE_DEBUG
-			printf("CONTROL EVENT %d %d\n", ev->data.control.param,
-			    ev->data.control.value);
-#endif
-			switch (ev->data.control.param) {
-			case 114:
-				global_led_gain = ev->data.control.value / 127.0;
-				break;
-			case 117:
-				global_spot_gain = ev->data.control.value / 127.0;
-				break;
-			case 116:
-				global_pixel_speed = ev->data.control.value / 127.0;
-				update_pixel_speed();
-				break;
-			case 113:
-				global_decay = ev->data.control.value + 1;
-				break;
-			default:
-				break;
-			}
-			break;
+static void
+update_pixel_speed(struct martin_dev *dev, float speed)
+{
+	struct sampler *smp = &dev->sampler;
+	uint32_t w_rand;
+	uint32_t h_rand;
 
-		default:
-#ifdef HAVE_DEBUG
-			printf("UNKNOWN EVENT %d\n", ev->type);
-#endif
-			break;
-		}
-		snd_seq_free_event(ev);
-	}
-	return (NULL);
+	if (image.data == NULL)
+		return;
+
+	/* both are below the image dimensions, so the step stays in range */
+	w_rand = sampler_random(smp, image.width) * speed;
+	h_rand = sampler_random(smp, image.height) * speed;
+
+	smp->step = w_rand + h_rand * image.width;
 }
 
-int
-main()
+static uint64_t
+monotonic_ns(void)
 {
-	struct usb_bus *busses;
-	struct usb_bus *bus;
-	struct usb_device *dev;
-	pthread_t thread;
-	int err;
+	struct timespec ts;
 
-#ifdef HAVE_PICTURE
-	image_size = width * height * 4;
-	image_data = header_data;
-#endif
-	usb_init();
-	usb_find_busses();
-	usb_find_devices();
-
-	busses = usb_get_busses();
-	for (bus = busses; bus; bus = bus->next) {
-		for (dev = bus->devices; dev; dev = dev->next) {
-			if (dev->descriptor.idVendor == USB_VENDOR &&
-			    dev->descriptor.idProduct == USB_PRODUCT) {
-				usb_devh_rx = usb_open(dev);
-				if (usb_devh_rx != NULL) {
-					if (usb_claim_interface(usb_devh_rx, 0) < 0 ||
-					    usb_set_altinterface(usb_devh_rx, 1) < 0)
-						goto fail_rx;
-					usb_devh_tx = usb_open(dev);
-					if (usb_devh_tx != NULL) {
-						if (usb_claim_interface(usb_devh_tx, 0) < 0 ||
-						    usb_set_altinterface(usb_devh_tx, 1) < 0) {
-							usb_close(usb_devh_rx);
-							goto fail_rx;
-						}
-						usb_martin_setup();
-						pthread_create(&thread, NULL, &usb_read_loop, NULL);
-						pthread_create(&thread, NULL, &usb_write_loop, NULL);
-						goto found;
-					} else {
-				fail_rx:
-						usb_close(usb_devh_rx);
-					}
-				}
-			}
-		}
-	}
-	printf("No Martin USB DMX device found\n");
-	return (1);
-found:
-	err = snd_seq_open(&alsa_seq, "default", SND_SEQ_OPEN_INPUT, 0);
-	if (err < 0) {
-		printf("Failed to open ALSA sequencer\n");
-		return (1);
-	}
-	snd_seq_set_client_name(alsa_seq, "Martin USB DMX");
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec);
+}
 
-	snd_seq_create_simple_port(alsa_seq, "port",
-	    SND_SEQ_PORT_CAP_WRITE | SND_SEQ_PORT_CAP_SUBS_WRITE,
-	    SND_SEQ_PORT_TYPE_MIDI_GENERIC);
+/*
+ * Statistics counters have a single writer each, so a plain load and
+ * store is enough and no locked instruction is needed in the hot path.
+ */
+static void
+stats_add(_Atomic uint64_t *ptr, uint64_t value)
+{
+	atomic_store_explicit(ptr, atomic_load_explicit(ptr,
+	    memory_order_relaxed) + value, memory_order_relaxed);
+}
+
+static void
+stats_hist(_Atomic uint64_t *hist, uint64_t ns)
+{
+	const uint64_t us = ns / 1000;
+	unsigned n = (us == 0) ? 0 : 64 - __builtin_clzll(us);
+
+	if (n >= MARTIN_STATS_HIST)
+		n = MARTIN_STATS_HIST - 1;
+	stats_add(hist + n, 1);
+}
+
+/*
+ * Record the time of an input event, unless an earlier one is still
+ * waiting to be sent.
+ */
+static void
+stats_event(struct martin_dev *dev, uint64_t when)
+{
+	uint64_t zero = 0;
+
+	atomic_compare_exchange_strong_explicit(&dev->event, &zero,
+	    when, memory_order_relaxed, memory_order_relaxed);
+}
+
+/*
+ * Export the statistics as a POSIX shared memory object.
+ */
+static void
+stats_open(const char *name)
+{
+	void *ptr;
+	int fd;
+
+	fd = shm_open(name, O_RDWR | O_CREAT, 0644);
+	if (fd < 0)
+		err(1, "Cannot open shared memory object %s", name);
+	if (ftruncate(fd, sizeof(*stats)) != 0)
+		err(1, "Cannot resize shared memory object %s", name);
+
+	ptr = mmap(NULL, sizeof(*stats), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+	if (ptr == MAP_FAILED)
+		err(1, "Cannot map shared memory object %s", name);
+
+	stats = ptr;
+	memset(stats, 0, sizeof(*stats));
+}
+
+/*
+ * Export the DMX universes as a POSIX shared memory object, which
+ * other processes write frames into.
+ */
+static void
+universe_open(const char *name)
+{
+	void *ptr;
+	int fd;
+
+	fd = shm_open(name, O_RDWR | O_CREAT, 0666);
+	if (fd < 0)
+		err(1, "Cannot open shared memory object %s", name);
+	if (ftruncate(fd, sizeof(*universes)) != 0)
+		err(1, "Cannot resize shared memory object %s", name);
+
+	ptr = mmap(NULL, sizeof(*universes), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+	if (ptr == MAP_FAILED)
+		err(1, "Cannot map shared memory object %s", name);
+
+	universes = ptr;
+	memset(universes, 0, sizeof(*universes));
+
+	for (unsigned x = 0; x != MARTIN_UNIVERSE_UNITS; x++) {
+		if (sem_init(&universes->unit[x].ready, 1, 0) != 0)
+			err(1, "Cannot create semaphore in %s", name);
+	}
+}
+
+static void
+sleep_until(uint64_t deadline)
+{
+	struct timespec ts;
+
+	ts.tv_sec = deadline / 1000000000ULL;
+	ts.tv_nsec = deadline % 1000000000ULL;
+
+	while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR)
+		;
+}
+
+enum {
+	WAIT_DEADLINE,
+	WAIT_MISSED,
+	WAIT_EVENT,
+};
+
+/*
+ * Wait until the given absolute deadline. In immediate mode the wait
+ * is cut short by frame_wake().
+ */
+static int
+wait_frame(struct martin_dev *dev, uint64_t deadline)
+{
+	struct timespec ts;
+	int retval = WAIT_DEADLINE;
+
+	if (monotonic_ns() >= deadline)
+		return (WAIT_MISSED);
+
+	if (frame_immediate == 0) {
+		sleep_until(deadline);
+		return (WAIT_DEADLINE);
+	}
+
+	ts.tv_sec = deadline / 1000000000ULL;
+	ts.tv_nsec = deadline % 1000000000ULL;
+
+	pthread_mutex_lock(&dev->frame_mtx);
+	while (dev->frame_wakeup == 0) {
+		if (pthread_cond_timedwait(&dev->frame_cond, &dev->frame_mtx, &ts) == ETIMEDOUT)
+			break;
+	}
+	if (dev->frame_wakeup != 0) {
+		dev->frame_wakeup = 0;
+		retval = WAIT_EVENT;
+	}
+	pthread_mutex_unlock(&dev->frame_mtx);
+
+	return (retval);
+}
+
+/*
+ * In lockstep mode the writers render in parallel and meet here
+ * before they transmit, so that all universes show the same frame.
+ * The join is a counting barrier on atomics, without locks. Each
+ * writer also passes its deadline, and all leave with the latest one,
+ * so that a writer which missed a deadline moves the common frame grid
+ * instead of falling out of step. The deadlines of a round are kept in
+ * their own slot, which is not reused before every writer has left.
+ */
+static struct {
+	atomic_uint count;	/* writers arrived in this round */
+	atomic_uint round;
+	_Atomic uint64_t deadline[2];	/* by round parity */
+	unsigned num;		/* writers taking part */
+}	frame_join;
+
+static uint64_t
+frame_join_wait(uint64_t deadline)
+{
+	const unsigned round = atomic_load_explicit(&frame_join.round, memory_order_acquire);
+	_Atomic uint64_t *latest = &frame_join.deadline[round & 1];
+	uint64_t value = atomic_load_explicit(latest, memory_order_relaxed);
+
+	/* deadlines only grow, so the slot needs no reset */
+	while (value < deadline && !atomic_compare_exchange_weak_explicit(latest,
+	    &value, deadline, memory_order_relaxed, memory_order_relaxed))
+		;
+
+	if (atomic_fetch_add_explicit(&frame_join.count, 1,
+	    memory_order_acq_rel) + 1 == frame_join.num) {
+		atomic_store_explicit(&frame_join.count, 0, memory_order_relaxed);
+		atomic_store_explicit(&frame_join.round, round + 1, memory_order_release);
+	} else {
+		/* yield, in case another writer waits for this CPU */
+		for (unsigned spin = 0; atomic_load_explicit(&frame_join.round,
+		    memory_order_acquire) == round; spin++) {
+			if (spin >= JOIN_SPIN)
+				sched_yield();
+		}
+	}
+	return (atomic_load_explicit(latest, memory_order_relaxed));
+}
+
+/*
+ * Ask the writer to send the next frame as soon as possible.
+ */
+static void
+frame_wake(struct martin_dev *dev)
+{
+	if (frame_immediate == 0)
+		return;
+
+	pthread_mutex_lock(&dev->frame_mtx);
+	dev->frame_wakeup = 1;
+	pthread_cond_signal(&dev->frame_cond);
+	pthread_mutex_unlock(&dev->frame_mtx);
+}
+
+/*
+ * Merge the active network sources of a unit into its network layer.
+ */
+static void
+net_publish(struct martin_dev *dev)
+{
+	const struct net_source *src = dev->net_source;
+	const struct net_source *latest = NULL;
+	unsigned seq = atomic_load_explicit(&dev->net.seq, memory_order_relaxed);
+	unsigned priority = 0;
+	uint8_t active = 0;
+
+	for (unsigned x = 0; x != NET_SOURCES; x++) {
+		if (src[x].expire != 0 && src[x].priority > priority)
+			priority = src[x].priority;
+	}
+
+	atomic_store_explicit(&dev->net.seq, seq + 1, memory_order_relaxed);
+	atomic_thread_fence(memory_order_release);
+
+	for (unsigned x = 0; x != NET_SOURCES; x++) {
+		if (src[x].expire == 0 || src[x].priority != priority)
+			continue;
+		if (net_merge == NET_LTP) {
+			if (latest == NULL || src[x].serial > latest->serial)
+				latest = src + x;
+		} else if (active == 0) {
+			memcpy(dev->net.data, src[x].data, DMX_SLOTS);
+		} else {
+			for (unsigned y = 0; y != DMX_SLOTS; y++) {
+				if (dev->net.data[y] < src[x].data[y])
+					dev->net.data[y] = src[x].data[y];
+			}
+		}
+		active = 1;
+	}
+	if (latest != NULL)
+		memcpy(dev->net.data, latest->data, DMX_SLOTS);
+	dev->net.active = active;
+
+	atomic_store_explicit(&dev->net.seq, seq + 2, memory_order_release);
+}
+
+/*
+ * Note and controller input, from either MIDI or the panel. Both are
+ * handled by the event loop, which owns "alsa_ctl". Input is taken in
+ * batches: controller changes only update "alsa_ctl", so that a fader
+ * sweep within one batch costs one publish, and the writer is woken
+ * once per batch by input_flush().
+ */
+static void
+input_pending(struct martin_dev *dev, uint64_t when)
+{
+	stats_add(&dev->stats->input_events, 1);
+	if (dev->input.pending)
+		return;
+	dev->input.pending = 1;
+	dev->input.when = when;
+}
+
+static void
+input_flush(void)
+{
+	for (unsigned x = 0; x != martin_num; x++) {
+		struct martin_dev *dev = martin_dev[x];
+
+		if (dev->input.pending == 0)
+			continue;
+		if (dev->input.publish)
+			control_publish(dev, &dev->alsa_ctl);
+		if (dev->input.net)
+			net_publish(dev);
+		stats_event(dev, dev->input.when);
+
+		if (dev->input.wake)
+			frame_wake(dev);
+
+		dev->input.pending = 0;
+		dev->input.publish = 0;
+		dev->input.wake = 0;
+		dev->input.net = 0;
+	}
+}
+
+/*
+ * Notes are scheduled at their time stamp plus the input latency.
+ * Controllers are continuous and always apply to the next frame.
+ */
+static void
+input_note(struct martin_dev *dev, unsigned note, unsigned velocity, uint64_t when)
+{
+	if (note > 127)
+		return;
+
+	/* selecting an effect is a control change */
+	if (patch.effect[note] != 0) {
+		dev->alsa_ctl.effect_wave = patch.effect[note] - 1;
+		dev->input.publish = 1;
+		dev->input.wake = 1;
+		input_pending(dev, when);
+	}
+
+	if (patch.note[note] == 0)
+		return;
+	if (trigger_enqueue(dev, patch.note[note] - 1, velocity, when + input_latency) != 0)
+		stats_add(&dev->stats->input_dropped, 1);
+	input_pending(dev, when);
+
+	/* with a latency, the trigger is not due yet */
+	if (input_latency == 0)
+		dev->input.wake = 1;
+}
+
+static void
+input_control(struct martin_dev *dev, unsigned param, int value, uint64_t when)
+{
+	struct control *ctl = &dev->alsa_ctl;
+
+	if (param > 127)
+		return;
+	dev->cc_value[param] = value;
+
+	switch (patch.cc[param]) {
+	case CC_LED_GAIN:
+		ctl->led_gain = value / 127.0;
+		break;
+	case CC_SPOT_GAIN:
+		ctl->spot_gain = value / 127.0;
+		break;
+	case CC_PIXEL_SPEED:
+		ctl->pixel_speed = value / 127.0;
+		break;
+	case CC_DECAY:
+		ctl->decay = value + 1;
+		break;
+	case CC_EFFECT_BPM:
+		ctl->effect_bpm = value + 60;
+		break;
+	case CC_EFFECT_DEPTH:
+		ctl->effect_depth = (value * 255) / 127;
+		break;
+	case CC_EFFECT_SPREAD:
+		ctl->effect_spread = value;
+		break;
+	default:
+		return;
+	}
+	dev->input.publish = 1;
+	dev->input.wake = 1;
+	input_pending(dev, when);
+}
+
+/*
+ * MIDI clock, 24 per beat, sets the effect tempo once per beat. MIDI
+ * start restarts the effect cycle.
+ */
+static void
+input_clock(struct martin_dev *dev, uint64_t when)
+{
+	if (dev->clock.count++ % MIDI_CLOCK_PPQN != 0)
+		return;
+	if (dev->clock.beat != 0 && when > dev->clock.beat) {
+		dev->alsa_ctl.effect_bpm = 60E9 / (when - dev->clock.beat);
+		dev->input.publish = 1;
+		input_pending(dev, when);
+	}
+	dev->clock.beat = when;
+}
+
+static void
+input_start(struct martin_dev *dev, uint64_t when)
+{
+	dev->clock.count = 0;
+	dev->alsa_ctl.effect_sync++;
+	dev->input.publish = 1;
+	input_pending(dev, when);
+}
+
+/*
+ * Data from the M-Touch, like button presses and fader moves, arrives
+ * here. Faders and buttons are acted on when they change only, so that
+ * repeated status packets do not override MIDI input.
+ */
+static void
+usb_rx_input(struct martin_dev *dev, const uint8_t *data, int length)
+{
+	uint8_t *last = dev->rx.last;
+	const uint64_t now = monotonic_ns();
+
+#ifdef HAVE_DEBUG
+	printf("USB RX UNIT %u:", dev->unit);
+	for (int x = 0; x != length; x++)
+		printf(" %02x", data[x]);
+	printf("\n");
+#endif
+	for (unsigned x = 0; x != patch.num_panel; x++) {
+		const struct panel_map *map = &patch.panel[x];
+		uint8_t value;
+		int step;
+
+		if (map->byte >= length)
+			continue;
+		value = data[map->byte];
+
+		switch (map->kind) {
+		case PANEL_FADER:
+			if (value != last[map->byte])
+				input_control(dev, map->target, value >> 1, now);
+			break;
+		case PANEL_BUTTON:
+			if ((value & ~last[map->byte]) & (1U << map->bit))
+				input_note(dev, map->target, 127, now);
+			break;
+		case PANEL_ENCODER:
+			if (value == 0)
+				break;
+			step = dev->cc_value[map->target] + (int8_t)value;
+			if (step < 0)
+				step = 0;
+			else if (step > 127)
+				step = 127;
+			input_control(dev, map->target, step, now);
+			break;
+		default:
+			break;
+		}
+	}
+	memcpy(last, data, length);
+	input_flush();
+}
+
+static void
+usb_rx_callback(struct libusb_transfer *xfer)
+{
+	struct martin_dev *dev = xfer->user_data;
+
+	if (xfer->status == LIBUSB_TRANSFER_COMPLETED) {
+		dev->rx.errors = 0;
+		usb_rx_input(dev, xfer->buffer, xfer->actual_length);
+	} else if (xfer->status == LIBUSB_TRANSFER_NO_DEVICE ||
+	    xfer->status == LIBUSB_TRANSFER_CANCELLED) {
+		goto failed;
+	} else if (dev->rx.errors++ == USB_RX_ERRORS) {
+		goto failed;
+	}
+	if (dev->state == UNIT_RUNNING && libusb_submit_transfer(xfer) == 0)
+		return;
+failed:
+	dev->rx.active = 0;
+	if (dev->state != UNIT_RUNNING)
+		return;
+
+	/* reopen the unit, a responsive device is found by the next scan */
+	if (xfer->status != LIBUSB_TRANSFER_NO_DEVICE)
+		printf("USB READ FAILED ON UNIT %u\n", dev->unit);
+	dev->gone = 1;
+}
+
+/*
+ * Keep one read pending on the receive endpoint. It completes in the
+ * event loop, so no thread is spent waiting for the device.
+ */
+static int
+usb_rx_start(struct martin_dev *dev)
+{
+	int err;
+
+	libusb_fill_bulk_transfer(dev->rx.xfer, dev->devh, USB_RX_ENDPOINT,
+	    dev->rx.data, sizeof(dev->rx.data), &usb_rx_callback, dev, 0);
+
+	dev->rx.errors = 0;
+	err = libusb_submit_transfer(dev->rx.xfer);
+	dev->rx.active = (err == 0);
+	return (err);
+}
+
+static void
+usb_tx_callback(struct libusb_transfer *xfer)
+{
+	struct usb_tx *tx = xfer->user_data;
+	struct martin_dev *dev = tx->dev;
+	const uint64_t now = monotonic_ns();
+
+	stats_hist(dev->stats->tx_latency, now - tx->submitted);
+	if (tx->event != 0)
+		stats_hist(dev->stats->event_latency, now - tx->event);
+	if (xfer->status != LIBUSB_TRANSFER_COMPLETED)
+		stats_add(&dev->stats->tx_errors, 1);
+
+	pthread_mutex_lock(&dev->tx_mtx);
+	tx->busy = 0;
+	dev->tx_time += ((int64_t)(now - tx->submitted) - (int64_t)dev->tx_time) / 8;
+	if (xfer->status == LIBUSB_TRANSFER_COMPLETED) {
+		dev->tx_errors = 0;
+	} else {
+		dev->tx_lost++;
+		if (dev->tx_errors != 255)
+			dev->tx_errors++;
+	}
+	pthread_mutex_unlock(&dev->tx_mtx);
+
+	if (xfer->status == LIBUSB_TRANSFER_NO_DEVICE)
+		dev->gone = 1;
+}
+
+/*
+ * Get the next transmit slot without waiting for the bus. Returns NULL
+ * if all transfers are still in flight. Else the packet buffer of the
+ * returned slot must be filled and passed to usb_tx_submit().
+ */
+static struct usb_tx *
+usb_tx_get(struct martin_dev *dev)
+{
+	struct usb_tx *tx = &dev->tx[dev->tx_next];
+
+	pthread_mutex_lock(&dev->tx_mtx);
+	if (tx->busy)
+		tx = NULL;
+	pthread_mutex_unlock(&dev->tx_mtx);
+
+	return (tx);
+}
+
+static uint8_t
+usb_tx_attached(struct martin_dev *dev)
+{
+	uint8_t retval;
+
+	pthread_mutex_lock(&dev->tx_mtx);
+	retval = dev->tx_attached;
+	pthread_mutex_unlock(&dev->tx_mtx);
+
+	return (retval);
+}
+
+static int
+usb_tx_submit(struct usb_tx *tx, int length)
+{
+	struct martin_dev *dev = tx->dev;
+	int err;
+
+	stats_add(&dev->stats->frames, 1);
+
+	/*
+	 * The frame carries all input events received so far. Take the
+	 * time in one step, so that an event recorded meanwhile is not
+	 * cleared before it was sent.
+	 */
+	tx->event = atomic_exchange_explicit(&dev->event, 0, memory_order_relaxed);
+
+	/* null backend, used for benchmarking */
+	if (dev->null_backend) {
+		dev->tx_next = (dev->tx_next + 1) % USB_TX_FRAMES;
+		return (0);
+	}
+	tx->submitted = monotonic_ns();
+
+	/* the handle is only valid while attached */
+	pthread_mutex_lock(&dev->tx_mtx);
+	if (dev->tx_attached) {
+		libusb_fill_bulk_transfer(tx->xfer, dev->devh, USB_TX_ENDPOINT,
+		    tx->data, length, &usb_tx_callback, tx, USB_TX_TIMEOUT);
+		err = libusb_submit_transfer(tx->xfer);
+	} else {
+		err = LIBUSB_ERROR_NO_DEVICE;
+	}
+	tx->busy = (err == 0);
+	if (err != 0) {
+		dev->tx_lost++;
+		if (dev->tx_errors != 255)
+			dev->tx_errors++;
+	}
+	pthread_mutex_unlock(&dev->tx_mtx);
+
+	dev->tx_next = (dev->tx_next + 1) % USB_TX_FRAMES;
+
+	return (err);
+}
+
+/*
+ * The number of frames lost so far. A later frame may complete before
+ * the writer looks, so the delta refresh compares this count with the
+ * one it last sent a full frame after, instead of the error count.
+ */
+static unsigned
+usb_tx_lost(struct martin_dev *dev)
+{
+	unsigned retval;
+
+	pthread_mutex_lock(&dev->tx_mtx);
+	retval = dev->tx_lost;
+	pthread_mutex_unlock(&dev->tx_mtx);
+
+	return (retval);
+}
+
+/*
+ * Adapt the frame period to the bus, for example a hub shared with
+ * audio interfaces. A dropped frame, a transfer error or an average
+ * completion time above the period lengthens the period by a quarter,
+ * down to FPS_MIN. After one second with completions below half the
+ * period, it is shortened by a quarter, back to the configured rate.
+ */
+static void
+usb_tx_adapt(struct martin_dev *dev, uint64_t nominal, uint64_t now, int dropped)
+{
+	uint64_t period = dev->adapt.period;
+	uint64_t time;
+	uint8_t errors;
+
+	pthread_mutex_lock(&dev->tx_mtx);
+	time = dev->tx_time;
+	errors = dev->tx_errors;
+	pthread_mutex_unlock(&dev->tx_mtx);
+
+	if (dropped || errors != 0 || time > period) {
+		period += period / 4;
+		if (period > 1000000000ULL / FPS_MIN)
+			period = 1000000000ULL / FPS_MIN;
+		dev->adapt.good = now;
+	} else if (time < period / 2 && period != nominal &&
+	    now - dev->adapt.good >= 1000000000ULL) {
+		period -= period / 4;
+		if (period < nominal)
+			period = nominal;
+		dev->adapt.good = now;
+	}
+
+	if (period == dev->adapt.period)
+		return;
+	dev->adapt.period = period;
+
+	atomic_store_explicit(&dev->stats->fps_target_milli,
+	    1000000000000ULL / period, memory_order_relaxed);
+
+	if (period == nominal) {
+		dev->adapt.congested = 0;
+		printf("USB WRITE BACK AT %u FPS ON UNIT %u\n", frame_rate, dev->unit);
+	} else if (dev->adapt.congested == 0) {
+		dev->adapt.congested = 1;
+		printf("USB WRITE CONGESTED, LOWERING THE FRAME RATE ON UNIT %u\n", dev->unit);
+	}
+}
+
+static void
+convert(const uint8_t *from, uint8_t *to)
+{
+	uint16_t c;
+
+	for (c = 0; c != 512;) {
+		*to++ = c & 0xFF;
+		*to++ = c >> 8;
+
+		for (uint8_t x = 0; x != 62 && c != 512; x++, c++)
+			*to++ = *from++;
+	}
+}
+
+/*
+ * Same as convert(), but only emit the 62-slot chunks which differ from
+ * what was last sent, unless "full" is set. The "sent" buffer is
+ * updated accordingly. Returns the number of bytes to transmit.
+ */
+static int
+convert_delta(const uint8_t *from, uint8_t *sent, uint8_t *to, int full)
+{
+	uint8_t *start = to;
+
+	for (uint16_t c = 0; c < 512; c += 62) {
+		uint16_t n = (512 - c) < 62 ? (512 - c) : 62;
+
+		if (!full && memcmp(from + c, sent + c, n) == 0)
+			continue;
+		memcpy(sent + c, from + c, n);
+
+		*to++ = c & 0xFF;
+		*to++ = c >> 8;
+		memcpy(to, from + c, n);
+		to += n;
+	}
+	return (to - start);
+}
+
+static void
+render(struct martin_dev *dev, uint8_t *buffer, const struct control *ctl)
+{
+	struct leds *leds = &dev->leds;
+	const level_t gain[CH_MAX] = {
+		[CH_I] = LEVEL(ctl->led_gain),
+		[CH_R] = LEVEL_ONE,
+		[CH_G] = LEVEL_ONE,
+		[CH_B] = LEVEL_ONE,
+	};
+	const level_t coeff = LEVEL(1.0f / ctl->decay);
+	const uint8_t *frame;
+	uint32_t pos;
+	uint8_t spot;
+
+	store(ctl->spot_gain, &spot, 255);
+	memset(buffer + patch.spot_start, spot, patch.spot_end - patch.spot_start);
+
+	if (image.data == NULL)
+		return;
+
+	/* all offsets are below image.pixels, so one subtract wraps them */
+	pos = sampler_wrap(dev->sampler.pos + dev->sampler.step, image.pixels);
+	dev->sampler.pos = pos;
+
+	if (++dev->image_frame == image.frames)
+		dev->image_frame = 0;
+
+	frame = image.data + dev->image_frame * image.stride;
+
+	for (unsigned x = 0; x != leds->num; x++) {
+		const uint8_t *pixel =
+		    frame + 3 * sampler_wrap(pos + image.sample[x], image.pixels);
+
+		leds->target[CH_I][x] = LEVEL_PIXEL3(pixel[0] + pixel[1] + pixel[2]);
+		leds->target[CH_R][x] = LEVEL_PIXEL(pixel[0]);
+		leds->target[CH_G][x] = LEVEL_PIXEL(pixel[1]);
+		leds->target[CH_B][x] = LEVEL_PIXEL(pixel[2]);
+	}
+
+	for (unsigned ch = 0; ch != CH_MAX; ch++) {
+		render_kernel(leds->value[ch], leds->target[ch], leds->out[ch],
+		    leds->stride, coeff, gain[ch]);
+	}
+}
+
+static void
+wave_init(void)
+{
+	uint64_t state = 0x9E3779B97F4A7C15ULL;
+	uint8_t level = 0;
+
+	for (unsigned x = 0; x != WAVE_SIZE; x++) {
+		wave_table[WAVE_SINE][x] =
+		    127.5 - 127.5 * cos(2.0 * M_PI * x / WAVE_SIZE) + 0.5;
+		wave_table[WAVE_SAW][x] = (x * 255) / (WAVE_SIZE - 1);
+		wave_table[WAVE_SQUARE][x] = (x < WAVE_SIZE / 2) ? 255 : 0;
+
+		/* fixed sequence, so that a show can be reproduced */
+		if (x % (WAVE_SIZE / WAVE_RANDOM_STEPS) == 0) {
+			state ^= state >> 12;
+			state ^= state << 25;
+			state ^= state >> 27;
+			level = (state * 0x2545F4914F6CDD1DULL) >> 56;
+		}
+		wave_table[WAVE_RANDOM][x] = level;
+	}
+}
+
+/*
+ * Run the effect, which is merged with the rendered intensity by the
+ * quantise step. This costs one table lookup and one multiply per
+ * fixture.
+ */
+static void
+effect_render(struct martin_dev *dev, const struct control *ctl, uint64_t when)
+{
+	const struct leds *leds = &dev->leds;
+	const uint8_t *wave = wave_table[ctl->effect_wave];
+	const unsigned depth = ctl->effect_depth;
+	const uint32_t step = (uint32_t)ctl->effect_spread << 25;
+	uint32_t phase;
+
+	if (dev->effect.sync != ctl->effect_sync || dev->effect.last == 0) {
+		dev->effect.sync = ctl->effect_sync;
+		dev->effect.phase = 0;
+	} else {
+		/* only the fraction of a cycle matters */
+		dev->effect.phase += (uint64_t)((when - dev->effect.last) *
+		    (ctl->effect_bpm * (4294967296.0 / 60E9)));
+	}
+	dev->effect.last = when;
+
+	/* clear the effect once after it stops */
+	if (ctl->effect_wave == WAVE_OFF) {
+		if (dev->effect.idle == 0)
+			memset(leds->effect, 0, leds->num * sizeof(leds->effect[0]));
+		dev->effect.idle = 1;
+		return;
+	}
+	dev->effect.idle = 0;
+
+	phase = dev->effect.phase;
+	for (unsigned x = 0; x != leds->num; x++, phase += step) {
+		const unsigned level = (wave[phase >> (32 - WAVE_BITS)] * depth + 255) >> 8;
+
+		/* level * (CURVE_SIZE - 1) / 255 */
+		leds->effect[x] = (level << (CURVE_BITS - 8)) | (level >> (16 - CURVE_BITS));
+	}
+}
+
+/*
+ * Map the rendered levels through the response curve of each channel
+ * and scatter them into the DMX frame. A 16-bit channel gets the curve
+ * output, scaled to 0..65535, as a coarse and a fine slot. With
+ * dithering, the fraction of the curve output of the 8-bit channels is
+ * spread over 16 frames by an ordered threshold, which is offset per
+ * fixture so that the fixtures do not step at the same time. Fades
+ * then have about 12 bits of effective resolution, at the cost of
+ * larger delta frames.
+ */
+static void
+quantise(struct martin_dev *dev, uint8_t *buffer)
+{
+	static const uint8_t ordered[16] = {
+		8, 136, 72, 200, 40, 168, 104, 232,
+		24, 152, 88, 216, 56, 184, 120, 248,
+	};
+	static const uint8_t rounded[16] = {
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+	};
+	const struct leds *leds = &dev->leds;
+	const uint8_t *threshold = dither ? ordered : rounded;
+	const unsigned frame = dev->dither_frame++;
+
+	for (unsigned ch = 0; ch != CH_MAX; ch++) {
+		const uint16_t *out = leds->out[ch];
+		const uint16_t *offset = leds->offset[ch];
+		const uint16_t *fine = leds->fine[ch];
+		const uint8_t *curve = leds->curve[ch];
+
+		for (unsigned x = 0; x != leds->num; x++) {
+			unsigned index = out[x];
+			unsigned level;
+
+			if (ch == CH_I && leds->effect[x] > index)
+				index = leds->effect[x];
+			level = patch.curve[curve[x]][index];
+
+			if (fine[x] != DMX_SLOT_NONE) {
+				/* level * 65535 / CURVE_ONE */
+				level += level >> 8;
+				buffer[offset[x]] = level >> 8;
+				buffer[fine[x]] = level & 0xFF;
+			} else {
+				buffer[offset[x]] = (level +
+				    threshold[(frame + 5 * x + 3 * ch) % 16]) >> 8;
+			}
+		}
+	}
+}
+
+/*
+ * Merge the network layer into the rendered frame. Returns the frame
+ * to send, which is "buffer" itself while no sender is active. The
+ * reads are bounded like in control_snapshot().
+ */
+static const uint8_t *
+net_apply(struct martin_dev *dev, const uint8_t *buffer, uint8_t *merged)
+{
+	unsigned seq;
+	uint8_t active;
+
+	for (unsigned x = 0; x != SEQLOCK_RETRY; x++) {
+		seq = atomic_load_explicit(&dev->net.seq, memory_order_acquire);
+		if (seq == dev->net_last.seq)
+			break;
+		if (seq & 1)
+			continue;
+		active = dev->net.active;
+		if (active)
+			memcpy(merged, dev->net.data, DMX_SLOTS);
+		atomic_thread_fence(memory_order_acquire);
+		if (atomic_load_explicit(&dev->net.seq, memory_order_relaxed) != seq)
+			continue;
+		dev->net_last.active = active;
+		if (active)
+			memcpy(dev->net_last.data, merged, DMX_SLOTS);
+		dev->net_last.seq = seq;
+		break;
+	}
+
+	if (dev->net_last.active == 0)
+		return (buffer);
+
+	memcpy(merged, dev->net_last.data, DMX_SLOTS);
+
+	/* the local output takes part in the HTP merge, LTP replaces it */
+	if (net_merge == NET_HTP) {
+		for (unsigned x = 0; x != DMX_SLOTS; x++) {
+			if (merged[x] < buffer[x])
+				merged[x] = buffer[x];
+		}
+	}
+	return (merged);
+}
+
+/*
+ * Merge the shared memory universe into the frame, by the same rule as
+ * the network senders. The producer may have died in the middle of a
+ * write, so the number of reads is bounded, and the last complete
+ * frame is used after that.
+ */
+static const uint8_t *
+universe_apply(struct martin_dev *dev, const uint8_t *frame, uint8_t *merged)
+{
+	struct martin_universe *map = dev->universe.map;
+	uint8_t data[DMX_SLOTS];
+	unsigned seq;
+
+	if (map == NULL || atomic_load_explicit(&map->active, memory_order_relaxed) == 0)
+		return (frame);
+
+	for (unsigned x = 0; x != UNIVERSE_RETRY; x++) {
+		seq = atomic_load_explicit(&map->seq, memory_order_acquire);
+		if (seq == dev->universe.seq)
+			break;
+		if (seq & 1)
+			continue;
+		memcpy(data, map->data, DMX_SLOTS);
+		atomic_thread_fence(memory_order_acquire);
+		if (atomic_load_explicit(&map->seq, memory_order_relaxed) != seq)
+			continue;
+		memcpy(dev->universe.data, data, DMX_SLOTS);
+		dev->universe.seq = seq;
+		break;
+	}
+
+	/* nothing complete yet */
+	if (dev->universe.seq & 1)
+		return (frame);
+
+	if (net_merge == NET_LTP)
+		return (dev->universe.data);
+
+	/* "frame" may be "merged" itself */
+	for (unsigned x = 0; x != DMX_SLOTS; x++) {
+		const uint8_t value = dev->universe.data[x];
+
+		merged[x] = (frame[x] < value) ? value : frame[x];
+	}
+	return (merged);
+}
+
+/*
+ * Turn the "ready" posts of a producer into immediate frames. Posts
+ * which arrive while a frame is pending are folded into it.
+ */
+static void *
+universe_wait_loop(void *arg)
+{
+	struct martin_dev *dev = arg;
+	sem_t *ready = &dev->universe.map->ready;
+
+	while (1) {
+		if (sem_wait(ready) != 0) {
+			if (errno == EINTR)
+				continue;
+			break;
+		}
+		while (sem_trywait(ready) == 0)
+			;
+		stats_event(dev, monotonic_ns());
+		frame_wake(dev);
+	}
+	printf("UNIVERSE WAIT FAILED ON UNIT %u\n", dev->unit);
+	return (NULL);
+}
+
+/*
+ * Hand a packet to the recorder. A full queue drops the record, the
+ * frame itself is still sent. Returns non-zero when dropped.
+ */
+static int
+record_push(struct martin_dev *dev, uint64_t when, const uint8_t *data, int length)
+{
+	unsigned head = atomic_load_explicit(&dev->record.head, memory_order_relaxed);
+	unsigned tail = atomic_load_explicit(&dev->record.tail, memory_order_acquire);
+	struct record_frame *frame;
+
+	if (head - tail == RECORD_QUEUE)
+		return (1);
+
+	frame = &dev->record.frame[head % RECORD_QUEUE];
+	frame->when = when;
+	frame->length = length;
+	memcpy(frame->data, data, length);
+
+	atomic_store_explicit(&dev->record.head, head + 1, memory_order_release);
+	return (0);
+}
+
+static void
+record_varint(uint64_t value)
+{
+	while (value >= 0x80) {
+		putc((value & 0x7F) | 0x80, record_file);
+		value >>= 7;
+	}
+	putc(value, record_file);
+}
+
+/*
+ * Write one packet as runs of bytes which are equal to, and which
+ * differ from, the previous packet of the unit. Runs of equal bytes
+ * shorter than RECORD_RUN_MIN are cheaper to store as literals.
+ */
+static void
+record_write(struct martin_dev *dev, const struct record_frame *frame, uint64_t delta)
+{
+	const uint8_t *data = frame->data;
+	uint8_t *last = dev->record.last;
+	const unsigned length = frame->length;
+	unsigned pos = 0;
+
+	record_varint(delta / 1000);
+	putc(dev->unit, record_file);
+	record_varint(length);
+
+	while (pos != length) {
+		unsigned equal = 0;
+		unsigned literal = 0;
+		unsigned run = 0;
+
+		while (pos + equal != length && data[pos + equal] == last[pos + equal])
+			equal++;
+		for (unsigned x = pos + equal; x != length; x++) {
+			if (data[x] == last[x]) {
+				if (++run == RECORD_RUN_MIN)
+					break;
+			} else {
+				literal += run + 1;
+				run = 0;
+			}
+		}
+		record_varint(equal);
+		record_varint(literal);
+		fwrite(data + pos + equal, 1, literal, record_file);
+		pos += equal + literal;
+
+		/* the rest of the packet is equal */
+		if (literal == 0)
+			pos = length;
+	}
+	memcpy(last, data, length);
+}
+
+/*
+ * Append the queued packets which are older than "horizon" to the
+ * file, merging the units by time.
+ */
+static void
+record_drain(uint64_t horizon, uint64_t *prev)
+{
+	while (1) {
+		struct martin_dev *dev = NULL;
+		const struct record_frame *frame = NULL;
+
+		for (unsigned x = 0; x != martin_num; x++) {
+			struct martin_dev *other = martin_dev[x];
+			unsigned tail = atomic_load_explicit(&other->record.tail, memory_order_relaxed);
+			unsigned head = atomic_load_explicit(&other->record.head, memory_order_acquire);
+			const struct record_frame *next = &other->record.frame[tail % RECORD_QUEUE];
+
+			if (tail == head || next->when > horizon)
+				continue;
+			if (frame == NULL || next->when < frame->when) {
+				dev = other;
+				frame = next;
+			}
+		}
+		if (frame == NULL)
+			break;
+
+		/* a packet later than RECORD_HOLD is written without delay */
+		if (*prev == 0)
+			*prev = frame->when;
+		if (frame->when < *prev) {
+			record_write(dev, frame, 0);
+		} else {
+			const uint64_t delta = (frame->when - *prev) / 1000 * 1000;
+
+			/* advance by what was recorded, so the error does not add up */
+			record_write(dev, frame, delta);
+			*prev += delta;
+		}
+
+		atomic_store_explicit(&dev->record.tail,
+		    atomic_load_explicit(&dev->record.tail, memory_order_relaxed) + 1,
+		    memory_order_release);
+	}
+}
+
+static void *
+record_loop(void *arg)
+{
+	uint64_t prev = 0;
+
+	while (1) {
+		const uint64_t now = monotonic_ns();
+
+		sleep_until(now + RECORD_INTERVAL);
+		record_drain(now + RECORD_INTERVAL - RECORD_HOLD, &prev);
+		if (fflush(record_file) != 0)
+			err(1, "Cannot write the recording");
+	}
+	return (NULL);
+}
+
+static void
+record_open(const char *file)
+{
+	record_file = fopen(file, "wb");
+	if (record_file == NULL)
+		err(1, "Cannot create %s", file);
+	fwrite(RECORD_MAGIC, 1, sizeof(RECORD_MAGIC) - 1, record_file);
+}
+
+static void *
+usb_write_loop(void *arg)
+{
+	struct martin_dev *dev = arg;
+	uint8_t buffer[DMX_SLOTS + 1] = {};
+	uint8_t merged[DMX_SLOTS];
+	uint8_t sent[DMX_SLOTS] = {};
+	const uint8_t *frame;
+	uint32_t missed = 0;
+	uint32_t dropped = 0;
+	uint32_t unrecorded = 0;
+	unsigned synced = 0;	/* lost frames covered by a full frame */
+	const uint64_t nominal = 1000000000ULL / frame_rate;
+	uint64_t period = nominal;
+	uint64_t deadline = monotonic_ns();
+	uint64_t last = 0;
+	uint64_t refresh = 0;
+	uint64_t report = deadline;
+	uint64_t rate_start = deadline;
+	uint64_t rate_frames = 0;
+	uint64_t unchanged = 0;	/* delta frames on time, nothing to send */
+	struct control ctl;
+	float pixel_speed = 0;
+	uint8_t attached = 1;
+	uint8_t unsent = 1;	/* no full frame since start or reattach */
+
+	dev->adapt.period = nominal;
+	dev->adapt.good = deadline;
+	atomic_store_explicit(&dev->stats->fps_target_milli,
+	    frame_rate * 1000, memory_order_relaxed);
+
+	while (1) {
+		struct usb_tx *tx;
+		uint64_t now;
+
+		/*
+		 * Frames are sent on absolute deadlines, so that neither
+		 * the transfer nor the render time adds to the period.
+		 */
+		deadline += period;
+		switch (wait_frame(dev, deadline)) {
+		case WAIT_MISSED:
+			now = monotonic_ns();
+
+			/* skip the lost slots instead of sending a burst */
+			missed += (now - deadline) / period + 1;
+			stats_add(&dev->stats->missed, (now - deadline) / period + 1);
+			deadline = now;
+			break;
+		case WAIT_EVENT:
+			/* keep a minimum distance to the previous frame */
+			if (monotonic_ns() < last + frame_spacing)
+				sleep_until(last + frame_spacing);
+
+			/* restart the frame grid at this early frame */
+			deadline = monotonic_ns();
+			break;
+		default:
+			break;
+		}
+		last = deadline;
+
+		control_snapshot(dev, &ctl);
+		trigger_dequeue(dev, deadline);
+
+		if (ctl.pixel_speed != pixel_speed) {
+			pixel_speed = ctl.pixel_speed;
+			update_pixel_speed(dev, pixel_speed);
+		}
+
+		render(dev, buffer, &ctl);
+		effect_render(dev, &ctl, deadline);
+		quantise(dev, buffer);
+		frame = net_apply(dev, buffer, merged);
+		frame = universe_apply(dev, frame, merged);
+
+		if (frame_lockstep)
+			deadline = frame_join_wait(deadline);
+
+		/*
+		 * While unplugged, frames are rendered but not sent, so
+		 * that the output is current when the unit comes back.
+		 */
+		if (usb_tx_attached(dev) == 0) {
+			attached = 0;
+			unsent = 1;
+			goto done;
+		} else if (attached == 0) {
+			attached = 1;
+			period = dev->adapt.period = nominal;
+			dev->adapt.good = deadline;
+		}
+
+		/*
+		 * Frame N is handed to the USB stack and frame N + 1 is
+		 * rendered while it is on the wire. If the bus has not
+		 * completed the previous frames yet, drop this one.
+		 */
+		tx = usb_tx_get(dev);
+		if (tx == NULL) {
+			dropped++;
+			stats_add(&dev->stats->dropped, 1);
+		} else if (usb_tx_delta) {
+			/*
+			 * Send only the changed chunks. Send all slots
+			 * first, then once a second and after any lost
+			 * frame, until a full frame was submitted.
+			 */
+			const unsigned lost = usb_tx_lost(dev);
+			int full = unsent || lost != synced ||
+			    deadline - refresh >= 1000000000ULL;
+			int length = convert_delta(frame, sent, tx->data, full);
+
+			if (full)
+				refresh = deadline;
+			if (length != 0) {
+				if (record_file != NULL)
+					unrecorded += record_push(dev, deadline, tx->data, length);
+				if (usb_tx_submit(tx, length) == 0 && full) {
+					synced = lost;
+					unsent = 0;
+				}
+			} else {
+				unchanged++;
+			}
+		} else {
+			convert(frame, tx->data);
+			if (record_file != NULL)
+				unrecorded += record_push(dev, deadline, tx->data, USB_PACKET_SIZE);
+			usb_tx_submit(tx, USB_PACKET_SIZE);
+		}
+
+		/*
+		 * Transfer errors lower the rate instead of ending the
+		 * loop. The grid of lockstep mode stays at the nominal
+		 * rate, and a congested unit drops frames instead.
+		 */
+		if (frame_lockstep == 0) {
+			usb_tx_adapt(dev, nominal, deadline, tx == NULL);
+			period = dev->adapt.period;
+		}
+done:
+
+		/*
+		 * The frame counter of the statistics includes this frame.
+		 * Delta frames without changes are on time as well.
+		 */
+		if (deadline - rate_start >= 1000000000ULL) {
+			const uint64_t frames = unchanged + atomic_load_explicit(
+			    &dev->stats->frames, memory_order_relaxed);
+
+			atomic_store_explicit(&dev->stats->fps_milli,
+			    (frames - rate_frames) * 1000000000000ULL /
+			    (deadline - rate_start), memory_order_relaxed);
+			rate_frames = frames;
+			rate_start = deadline;
+		}
+
+		if (deadline - report >= 30000000000ULL) {
+			report = deadline;
+			update_pixel_speed(dev, pixel_speed);
+
+			if (dev->adapt.congested) {
+				const uint32_t fps = atomic_load_explicit(
+				    &dev->stats->fps_milli, memory_order_relaxed);
+
+				printf("USB WRITE AT %u.%03u OF %u FPS ON UNIT %u\n",
+				    fps / 1000, fps % 1000, frame_rate, dev->unit);
+			}
+			if (missed != 0) {
+				printf("USB WRITE MISSED %u DEADLINES ON UNIT %u\n", missed, dev->unit);
+				missed = 0;
+			}
+			if (dropped != 0) {
+				printf("USB WRITE DROPPED %u FRAMES ON UNIT %u\n", dropped, dev->unit);
+				dropped = 0;
+			}
+			if (unrecorded != 0) {
+				printf("RECORDER DROPPED %u FRAMES ON UNIT %u\n", unrecorded, dev->unit);
+				unrecorded = 0;
+			}
+		}
+	}
+	return (NULL);
+}
+
+/*
+ * Send a recording through the transmit path, either at its original
+ * timing or as fast as the bus takes it. In timed mode a packet is
+ * dropped when the bus is still busy, like in the writer. Packets of
+ * units which are not present are skipped.
+ */
+static int
+replay_varint(FILE *file, uint64_t *value)
+{
+	*value = 0;
+
+	for (unsigned shift = 0; shift < 64; shift += 7) {
+		const int c = getc(file);
+
+		if (c == EOF)
+			return (-1);
+		*value |= (uint64_t)(c & 0x7F) << shift;
+		if ((c & 0x80) == 0)
+			return (0);
+	}
+	return (-1);
+}
+
+/*
+ * Read one record and apply it to the previous packet of its unit.
+ * Returns 1 at the end of the file, and -1 if the file is truncated or
+ * corrupt.
+ */
+static int
+replay_read(FILE *file, uint64_t *delta, unsigned *unit, uint8_t last[][USB_PACKET_SIZE],
+    unsigned *length)
+{
+	uint64_t value;
+	unsigned pos = 0;
+	int c;
+
+	if ((c = getc(file)) == EOF)
+		return (1);
+	ungetc(c, file);
+
+	if (replay_varint(file, delta) != 0 || (c = getc(file)) == EOF ||
+	    c >= MAX_DEVICES || replay_varint(file, &value) != 0 ||
+	    value > USB_PACKET_SIZE)
+		return (-1);
+	*unit = c;
+	*length = value;
+
+	while (pos != *length) {
+		uint64_t equal;
+		uint64_t literal;
+
+		if (replay_varint(file, &equal) != 0 ||
+		    replay_varint(file, &literal) != 0 ||
+		    equal + literal > *length - pos)
+			return (-1);
+		pos += equal;
+		if (fread(last[*unit] + pos, 1, literal, file) != literal)
+			return (-1);
+		pos += literal;
+
+		if (literal == 0)
+			pos = *length;
+	}
+	return (0);
+}
+
+static void *
+replay_loop(void *arg)
+{
+	static uint8_t last[MAX_DEVICES][USB_PACKET_SIZE];
+	char magic[sizeof(RECORD_MAGIC) - 1];
+	FILE *file;
+	uint64_t start;
+	uint64_t when = 0;
+	uint64_t frames = 0;
+	uint64_t bytes = 0;
+	uint64_t dropped = 0;
+	uint64_t delta;
+	unsigned unit;
+	unsigned length;
+	int error;
+
+	file = fopen(replay_file, "rb");
+	if (file == NULL)
+		err(1, "Cannot open %s", replay_file);
+	if (fread(magic, 1, sizeof(magic), file) != sizeof(magic) ||
+	    memcmp(magic, RECORD_MAGIC, sizeof(magic)) != 0)
+		errx(1, "%s is not a recording", replay_file);
+
+	start = monotonic_ns();
+
+	while ((error = replay_read(file, &delta, &unit, last, &length)) == 0) {
+		struct martin_dev *dev;
+		struct usb_tx *tx;
+
+		when += delta * 1000;
+		if (unit >= martin_num || length == 0)
+			continue;
+		dev = martin_dev[unit];
+
+		if (replay_fast) {
+			while ((tx = usb_tx_get(dev)) == NULL)
+				sleep_until(monotonic_ns() + 100000);
+		} else {
+			sleep_until(start + when);
+			tx = usb_tx_get(dev);
+			if (tx == NULL) {
+				dropped++;
+				stats_add(&dev->stats->dropped, 1);
+				continue;
+			}
+		}
+		memcpy(tx->data, last[unit], length);
+		usb_tx_submit(tx, length);
+		frames++;
+		bytes += length;
+	}
+	if (error < 0)
+		printf("Recording %s is truncated or corrupt\n", replay_file);
+	fclose(file);
+
+	/* let the last transfers complete */
+	for (unsigned x = 0; x != martin_num; x++) {
+		struct martin_dev *dev = martin_dev[x];
+
+		for (unsigned y = 0; y != USB_TX_FRAMES; y++) {
+			while (1) {
+				uint8_t busy;
+
+				pthread_mutex_lock(&dev->tx_mtx);
+				busy = dev->tx[y].busy;
+				pthread_mutex_unlock(&dev->tx_mtx);
+				if (busy == 0)
+					break;
+				sleep_until(monotonic_ns() + 100000);
+			}
+		}
+	}
+	delta = monotonic_ns() - start;
+
+	printf("Replayed %llu packets, %llu bytes in %.3f s, %.1f packets/s, %llu dropped\n",
+	    (unsigned long long)frames, (unsigned long long)bytes, delta / 1e9,
+	    frames * 1e9 / (delta ? delta : 1), (unsigned long long)dropped);
+	exit(0);
+}
+
+#include "martin_init.h"
+
+/*
+ * Check if a request of the init sequence can be left out in fast
+ * mode. The standard descriptor reads are answered from the LibUSB
+ * cache anyway, and the long runs of identical LED data writes only
+ * hold the panel LEDs in the same state. Other vendor requests are
+ * device commands and are always sent, also when repeated.
+ */
+static int
+usb_martin_setup_skip(const struct setup_request *req)
+{
+	if (req->bmRequestType == LIBUSB_ENDPOINT_IN &&
+	    req->bRequest == LIBUSB_REQUEST_GET_DESCRIPTOR)
+		return (1);
+
+	if (req == s_setupRequest || (req->bmRequestType & LIBUSB_ENDPOINT_IN) ||
+	    req->bRequest != USB_SETUP_LED_WRITE || req->cbData == 0)
+		return (0);
+
+	/* identical payloads share the same offset */
+	return (req[-1].bmRequestType == req->bmRequestType &&
+	    req[-1].bRequest == req->bRequest &&
+	    req[-1].wValue == req->wValue &&
+	    req[-1].wIndex == req->wIndex &&
+	    req[-1].cbData == req->cbData &&
+	    req[-1].offset == req->offset);
+}
+
+static int
+usb_martin_setup(struct martin_dev *dev)
+{
+	const struct setup_request *req = s_setupRequest;
+	const struct setup_request *end = s_setupRequest + (sizeof(s_setupRequest) / sizeof(*req));
+	const unsigned timeout = usb_setup_fast ? USB_SETUP_TIMEOUT_FAST : USB_SETUP_TIMEOUT;
+	const unsigned retry = usb_setup_fast ? USB_SETUP_RETRY_FAST : 0;
+	uint8_t buffer[SETUP_DATA_MAX];
+
+	for (; req != end; req++) {
+		unsigned n;
+
+		if (usb_setup_fast && usb_martin_setup_skip(req))
+			continue;
+
+		for (n = 0; n <= retry; n++) {
+			/* LibUSB wants a writable buffer also for writes */
+			if (!(req->bmRequestType & LIBUSB_ENDPOINT_IN))
+				memcpy(buffer, s_setupData + req->offset, req->cbData);
+
+			if (libusb_control_transfer(dev->devh,
+			    req->bmRequestType,
+			    req->bRequest,
+			    req->wValue,
+			    req->wIndex,
+			    buffer, req->cbData, timeout) >= 0)
+				break;
+			if (n != retry)
+				stats_add(&dev->stats->setup_retries, 1);
+		}
+		if (n > retry) {
+			printf("USB control request failed on unit %u\n", dev->unit);
+			return (-1);
+		}
+	}
+	return (0);
+}
+
+static void *
+usb_martin_setup_thread(void *arg)
+{
+	return ((void *)(intptr_t)usb_martin_setup(arg));
+}
+
+/*
+ * A replugged unit runs the init sequence from the event loop, one
+ * asynchronous control request at a time, always in fast mode, so that
+ * the other units keep running. Returns 1 when all requests are done.
+ */
+static int
+usb_setup_submit(struct martin_dev *dev, libusb_transfer_cb_fn callback)
+{
+	const unsigned num = sizeof(s_setupRequest) / sizeof(s_setupRequest[0]);
+	const struct setup_request *req;
+	int err;
+
+	while (dev->setup.next != num &&
+	    usb_martin_setup_skip(s_setupRequest + dev->setup.next))
+		dev->setup.next++;
+	if (dev->setup.next == num)
+		return (1);
+
+	req = s_setupRequest + dev->setup.next;
+	libusb_fill_control_setup(dev->setup.data, req->bmRequestType,
+	    req->bRequest, req->wValue, req->wIndex, req->cbData);
+	if (!(req->bmRequestType & LIBUSB_ENDPOINT_IN)) {
+		memcpy(dev->setup.data + LIBUSB_CONTROL_SETUP_SIZE,
+		    s_setupData + req->offset, req->cbData);
+	}
+	libusb_fill_control_transfer(dev->setup.xfer, dev->devh, dev->setup.data,
+	    callback, dev, USB_SETUP_TIMEOUT_FAST);
+
+	err = libusb_submit_transfer(dev->setup.xfer);
+	dev->setup.active = (err == 0);
+	return (err == 0 ? 0 : -1);
+}
+
+static void
+usb_setup_done(struct martin_dev *dev, int error)
+{
+	if (error == 0 && usb_rx_start(dev) == 0) {
+		pthread_mutex_lock(&dev->tx_mtx);
+		dev->tx_attached = 1;
+		dev->tx_errors = 0;
+		dev->tx_time = 0;
+		pthread_mutex_unlock(&dev->tx_mtx);
+
+		dev->state = UNIT_RUNNING;
+		printf("USB UNIT %u RECONNECTED IN %u MS\n", dev->unit,
+		    (unsigned)((monotonic_ns() - dev->setup.start) / 1000000));
+	} else {
+		printf("USB SETUP FAILED ON UNIT %u\n", dev->unit);
+		dev->state = UNIT_CLOSING;
+	}
+}
+
+static void
+usb_setup_callback(struct libusb_transfer *xfer)
+{
+	struct martin_dev *dev = xfer->user_data;
+	int ret;
+
+	dev->setup.active = 0;
+
+	if (xfer->status == LIBUSB_TRANSFER_COMPLETED) {
+		dev->setup.next++;
+		dev->setup.retry = 0;
+	} else if (xfer->status == LIBUSB_TRANSFER_NO_DEVICE ||
+	    xfer->status == LIBUSB_TRANSFER_CANCELLED ||
+	    dev->setup.retry++ == USB_SETUP_RETRY_FAST) {
+		usb_setup_done(dev, 1);
+		return;
+	} else {
+		stats_add(&dev->stats->setup_retries, 1);
+	}
+
+	ret = usb_setup_submit(dev, &usb_setup_callback);
+	if (ret != 0)
+		usb_setup_done(dev, ret < 0);
+}
+
+static void
+usb_setup_start(struct martin_dev *dev)
+{
+	int ret;
+
+	dev->state = UNIT_SETUP;
+	dev->setup.next = 0;
+	dev->setup.retry = 0;
+	dev->setup.start = monotonic_ns();
+
+	ret = usb_setup_submit(dev, &usb_setup_callback);
+	if (ret != 0)
+		usb_setup_done(dev, ret < 0);
+}
+
+static const char *const cc_name[] = {
+	[CC_NONE] = "none",
+	[CC_DECAY] = "decay",
+	[CC_LED_GAIN] = "led_gain",
+	[CC_SPOT_GAIN] = "spot_gain",
+	[CC_PIXEL_SPEED] = "pixel_speed",
+	[CC_EFFECT_BPM] = "effect_bpm",
+	[CC_EFFECT_DEPTH] = "effect_depth",
+	[CC_EFFECT_SPREAD] = "effect_spread",
+};
+
+static const char *const wave_name[WAVE_MAX] = {
+	[WAVE_OFF] = "off",
+	[WAVE_SINE] = "sine",
+	[WAVE_SAW] = "saw",
+	[WAVE_SQUARE] = "square",
+	[WAVE_RANDOM] = "random",
+};
+
+static void
+curve_build(uint16_t *lut, unsigned kind, double gamma, const uint8_t *point,
+    unsigned num)
+{
+	for (unsigned x = 0; x != CURVE_SIZE; x++) {
+		double v = x / (double)(CURVE_SIZE - 1);
+		double pos;
+		unsigned n;
+
+		switch (kind) {
+		case CURVE_GAMMA:
+			v = pow(v, gamma);
+			break;
+		case CURVE_SCURVE:
+			v = v * v * (3.0 - 2.0 * v);
+			break;
+		case CURVE_TABLE:
+			/* piecewise linear through points at equal steps */
+			pos = v * (num - 1);
+			n = (pos < num - 1) ? (unsigned)pos : num - 2;
+			v = (point[n] + (point[n + 1] - point[n]) * (pos - n)) / 255.0;
+			break;
+		default:
+			break;
+		}
+		lut[x] = v * CURVE_ONE + 0.5;
+	}
+}
+
+static void
+curve_default(void)
+{
+	free(patch.curve);
+	patch.curve = malloc(sizeof(patch.curve[0]));
+	if (patch.curve == NULL)
+		errx(1, "Out of memory");
+	patch.num_curve = 1;
+	curve_build(patch.curve[0], CURVE_LINEAR, 1.0, NULL, 0);
+}
+
+static void
+patch_default(void)
+{
+	curve_default();
+
+	patch.led = malloc(sizeof(led_map));
+	if (patch.led == NULL)
+		errx(1, "Out of memory");
+	memcpy(patch.led, led_map, sizeof(led_map));
+	patch.num_leds = LEDS;
+
+	/* entries with bit 7 set were never routed */
+	for (unsigned x = NOTE_START; x != NOTE_END; x++) {
+		if (midi_map[x - NOTE_START] >= 1 &&
+		    midi_map[x - NOTE_START] <= LEDS)
+			patch.note[x] = midi_map[x - NOTE_START];
+	}
+
+	patch.cc[113] = CC_DECAY;
+	patch.cc[114] = CC_LED_GAIN;
+	patch.cc[116] = CC_PIXEL_SPEED;
+	patch.cc[117] = CC_SPOT_GAIN;
+
+	patch.spot_start = SPOT_START;
+	patch.spot_end = SPOT_END;
+}
+
+static unsigned long
+patch_number(const char *file, unsigned line, const char *str, unsigned long max)
+{
+	unsigned long value;
+	char *end;
+
+	if (str == NULL)
+		errx(1, "%s:%u: Missing argument", file, line);
+	value = strtoul(str, &end, 0);
+	if (*end != 0 || value > max)
+		errx(1, "%s:%u: Invalid number '%s'", file, line, str);
+	return (value);
+}
+
+/*
+ * Parse a channel layout given as a list of "<channel>=<offset>"
+ * pairs, where channel is one of "i", "r", "g" and "b". The offset may
+ * be followed by ",<fine>", for a 16-bit channel, and ":<curve>". The
+ * first token has already been split off by the caller.
+ */
+static void
+patch_layout(const char *file, unsigned line, char *tok, char **pp, struct led_map *map,
+    char (*curve_name)[32])
+{
+	static const char ch_name[CH_MAX] = { [CH_I] = 'i', [CH_R] = 'r', [CH_G] = 'g', [CH_B] = 'b' };
+
+	for (unsigned ch = 0; ch != CH_MAX; ch++) {
+		map->offset[ch] = DMX_SLOT_NONE;
+		map->fine[ch] = DMX_SLOT_NONE;
+		map->curve[ch] = 0;
+	}
+
+	for (; tok != NULL; tok = strtok_r(NULL, " \t", pp)) {
+		char *name;
+		unsigned ch;
+		unsigned x;
+
+		for (ch = 0; ch != CH_MAX; ch++) {
+			if (tok[0] == ch_name[ch] && tok[1] == '=')
+				break;
+		}
+		if (ch == CH_MAX)
+			errx(1, "%s:%u: Invalid channel '%s'", file, line, tok);
+
+		name = strchr(tok, ':');
+		if (name != NULL) {
+			*name++ = 0;
+			for (x = 0; x != patch.num_curve; x++) {
+				if (strcmp(name, curve_name[x]) == 0)
+					break;
+			}
+			if (x == patch.num_curve)
+				errx(1, "%s:%u: Unknown curve '%s'", file, line, name);
+			map->curve[ch] = x;
+		}
+		name = strchr(tok, ',');
+		if (name != NULL) {
+			*name++ = 0;
+			map->fine[ch] = patch_number(file, line, name, DMX_SLOTS - 1);
+		}
+		map->offset[ch] = patch_number(file, line, tok + 2, DMX_SLOTS - 1);
+		if (map->offset[ch] == map->fine[ch])
+			errx(1, "%s:%u: Fine slot equals coarse slot", file, line);
+	}
+}
+
+/*
+ * Parse the definition of a response curve, after its name.
+ */
+static void
+patch_curve(const char *file, unsigned line, char **pp, uint16_t *lut)
+{
+	uint8_t point[CURVE_POINTS];
+	const char *tok = strtok_r(NULL, " \t", pp);
+	unsigned num = 0;
+	double gamma;
+	char *end;
+
+	if (tok != NULL && strcmp(tok, "linear") == 0) {
+		curve_build(lut, CURVE_LINEAR, 1.0, NULL, 0);
+	} else if (tok != NULL && strcmp(tok, "gamma") == 0) {
+		tok = strtok_r(NULL, " \t", pp);
+		if (tok == NULL)
+			errx(1, "%s:%u: Missing argument", file, line);
+		gamma = strtod(tok, &end);
+		if (*end != 0 || !(gamma >= 0.1 && gamma <= 10.0))
+			errx(1, "%s:%u: Invalid gamma '%s'", file, line, tok);
+		curve_build(lut, CURVE_GAMMA, gamma, NULL, 0);
+	} else if (tok != NULL && strcmp(tok, "scurve") == 0) {
+		curve_build(lut, CURVE_SCURVE, 1.0, NULL, 0);
+	} else if (tok != NULL && strcmp(tok, "table") == 0) {
+		while ((tok = strtok_r(NULL, " \t", pp)) != NULL) {
+			if (num == CURVE_POINTS)
+				errx(1, "%s:%u: Too many points", file, line);
+			point[num++] = patch_number(file, line, tok, 255);
+		}
+		if (num < 2)
+			errx(1, "%s:%u: A table needs two points or more", file, line);
+		curve_build(lut, CURVE_TABLE, 1.0, point, num);
+	} else {
+		errx(1, "%s:%u: Invalid curve", file, line);
+	}
+	if (strtok_r(NULL, " \t", pp) != NULL)
+		errx(1, "%s:%u: Too many arguments", file, line);
+}
+
+/*
+ * Load a fixture patch. Each line holds one directive:
+ *
+ *	curve <name> linear|scurve		define a response curve
+ *	curve <name> gamma <exponent>		define a power law curve
+ *	curve <name> table <level> ...		define a curve by points
+ *	layout <name> <ch>=<offset>[,<fine>][:<curve>] ...	define a channel layout
+ *	fixture <slot> <name>			add a fixture using a layout
+ *	fixture <slot> <ch>=<offset>[,<fine>][:<curve>] ...	add a fixture, inline layout
+ *	pixel <fixture> <x> <y>			set the image pixel to sample
+ *	note <note> <fixture>			bind a note to a fixture
+ *	effect <note> <waveform>		bind a note to an effect
+ *	cc <param> <function>			bind a controller
+ *	panel <control> <byte> [<bit>] <target>	bind a panel control
+ *	spot <start> <end>			set the spot slot range
+ *
+ * Fixtures are numbered from zero in the order they are added. The
+ * points of a table curve are DMX levels at equal steps and the curve
+ * "linear" is always defined. Curves are compiled into tables when
+ * loaded.
+ */
+static void
+patch_load(const char *file)
+{
+	struct {
+		char	name[32];
+		struct led_map map;
+	}	layout[16];
+	char curve_name[CURVE_MAX][32] = { "linear" };
+	unsigned num_layout = 0;
+	unsigned max_leds = 0;
+	unsigned line = 0;
+	char *str = NULL;
+	size_t size = 0;
+	FILE *fp;
+
+	fp = fopen(file, "r");
+	if (fp == NULL)
+		err(1, "Cannot open '%s'", file);
+
+	free(patch.led);
+	free(patch.curve);
+	memset(&patch, 0, sizeof(patch));
+
+	patch.curve = malloc(CURVE_MAX * sizeof(patch.curve[0]));
+	if (patch.curve == NULL)
+		errx(1, "Out of memory");
+	patch.num_curve = 1;
+	curve_build(patch.curve[0], CURVE_LINEAR, 1.0, NULL, 0);
+
+	while (getline(&str, &size, fp) > 0) {
+		char *ptr;
+		char *tok;
+
+		line++;
+		str[strcspn(str, "#\r\n")] = 0;
+
+		tok = strtok_r(str, " \t", &ptr);
+		if (tok == NULL)
+			continue;
+
+		if (strcmp(tok, "curve") == 0) {
+			unsigned x;
+
+			tok = strtok_r(NULL, " \t", &ptr);
+			if (tok == NULL || strlen(tok) >= sizeof(curve_name[0]))
+				errx(1, "%s:%u: Invalid curve name", file, line);
+			for (x = 0; x != patch.num_curve; x++) {
+				if (strcmp(tok, curve_name[x]) == 0)
+					break;
+			}
+			if (x == 0)
+				errx(1, "%s:%u: Cannot redefine the linear curve", file, line);
+			if (x == CURVE_MAX)
+				errx(1, "%s:%u: Too many curves", file, line);
+			if (x == patch.num_curve) {
+				strcpy(curve_name[x], tok);
+				patch.num_curve++;
+			}
+			patch_curve(file, line, &ptr, patch.curve[x]);
+		} else if (strcmp(tok, "layout") == 0) {
+			if (num_layout == sizeof(layout) / sizeof(layout[0]))
+				errx(1, "%s:%u: Too many layouts", file, line);
+			tok = strtok_r(NULL, " \t", &ptr);
+			if (tok == NULL || strlen(tok) >= sizeof(layout[0].name))
+				errx(1, "%s:%u: Invalid layout name", file, line);
+			strcpy(layout[num_layout].name, tok);
+			patch_layout(file, line, strtok_r(NULL, " \t", &ptr), &ptr,
+			    &layout[num_layout].map, curve_name);
+			num_layout++;
+		} else if (strcmp(tok, "fixture") == 0) {
+			unsigned base = patch_number(file, line, strtok_r(NULL, " \t", &ptr), DMX_SLOTS - 1);
+			struct led_map *map;
+			unsigned x;
+
+			if (patch.num_leds == max_leds) {
+				max_leds = max_leds ? 2 * max_leds : 16;
+				patch.led = realloc(patch.led, max_leds * sizeof(patch.led[0]));
+				if (patch.led == NULL)
+					errx(1, "Out of memory");
+			}
+			map = &patch.led[patch.num_leds++];
+			map->pixel = -1;
+
+			tok = strtok_r(NULL, " \t", &ptr);
+			for (x = 0; tok != NULL && x != num_layout; x++) {
+				if (strcmp(tok, layout[x].name) == 0)
+					break;
+			}
+			if (tok != NULL && x != num_layout)
+				*map = layout[x].map;
+			else
+				patch_layout(file, line, tok, &ptr, map, curve_name);
+
+			for (unsigned ch = 0; ch != CH_MAX; ch++) {
+				if (map->offset[ch] == DMX_SLOT_NONE)
+					continue;
+				map->offset[ch] += base;
+				if (map->offset[ch] >= DMX_SLOTS)
+					errx(1, "%s:%u: Fixture exceeds the universe", file, line);
+				if (map->fine[ch] == DMX_SLOT_NONE)
+					continue;
+				map->fine[ch] += base;
+				if (map->fine[ch] >= DMX_SLOTS)
+					errx(1, "%s:%u: Fixture exceeds the universe", file, line);
+			}
+		} else if (strcmp(tok, "pixel") == 0) {
+			unsigned which = patch_number(file, line, strtok_r(NULL, " \t", &ptr), UINT16_MAX - 1);
+			unsigned x = patch_number(file, line, strtok_r(NULL, " \t", &ptr), UINT16_MAX);
+			unsigned y = patch_number(file, line, strtok_r(NULL, " \t", &ptr), INT16_MAX);
+
+			if (which >= patch.num_leds)
+				errx(1, "%s:%u: Missing fixture %u", file, line, which);
+			/* resolved against the image size at startup */
+			patch.led[which].pixel = (y << 16) | x;
+		} else if (strcmp(tok, "note") == 0) {
+			unsigned note = patch_number(file, line, strtok_r(NULL, " \t", &ptr), 127);
+			unsigned which = patch_number(file, line, strtok_r(NULL, " \t", &ptr), UINT16_MAX - 1);
+
+			patch.note[note] = which + 1;
+		} else if (strcmp(tok, "effect") == 0) {
+			unsigned note = patch_number(file, line, strtok_r(NULL, " \t", &ptr), 127);
+			unsigned x;
+
+			tok = strtok_r(NULL, " \t", &ptr);
+			for (x = 0; tok != NULL && x != WAVE_MAX; x++) {
+				if (strcmp(tok, wave_name[x]) == 0)
+					break;
+			}
+			if (tok == NULL || x == WAVE_MAX)
+				errx(1, "%s:%u: Invalid waveform", file, line);
+			patch.effect[note] = x + 1;
+		} else if (strcmp(tok, "cc") == 0) {
+			unsigned param = patch_number(file, line, strtok_r(NULL, " \t", &ptr), 127);
+			unsigned x;
+
+			tok = strtok_r(NULL, " \t", &ptr);
+			for (x = 0; tok != NULL && x != sizeof(cc_name) / sizeof(cc_name[0]); x++) {
+				if (strcmp(tok, cc_name[x]) == 0)
+					break;
+			}
+			if (tok == NULL || x == sizeof(cc_name) / sizeof(cc_name[0]))
+				errx(1, "%s:%u: Invalid controller function", file, line);
+			patch.cc[param] = x;
+		} else if (strcmp(tok, "panel") == 0) {
+			struct panel_map *map;
+
+			if (patch.num_panel == PANEL_MAX)
+				errx(1, "%s:%u: Too many panel mappings", file, line);
+			map = &patch.panel[patch.num_panel++];
+
+			tok = strtok_r(NULL, " \t", &ptr);
+			if (tok != NULL && strcmp(tok, "fader") == 0)
+				map->kind = PANEL_FADER;
+			else if (tok != NULL && strcmp(tok, "button") == 0)
+				map->kind = PANEL_BUTTON;
+			else if (tok != NULL && strcmp(tok, "encoder") == 0)
+				map->kind = PANEL_ENCODER;
+			else
+				errx(1, "%s:%u: Invalid panel control", file, line);
+
+			map->byte = patch_number(file, line, strtok_r(NULL, " \t", &ptr), USB_RX_SIZE - 1);
+			if (map->kind == PANEL_BUTTON)
+				map->bit = patch_number(file, line, strtok_r(NULL, " \t", &ptr), 7);
+			map->target = patch_number(file, line, strtok_r(NULL, " \t", &ptr), 127);
+		} else if (strcmp(tok, "spot") == 0) {
+			patch.spot_start = patch_number(file, line, strtok_r(NULL, " \t", &ptr), DMX_SLOTS);
+			patch.spot_end = patch_number(file, line, strtok_r(NULL, " \t", &ptr), DMX_SLOTS);
+			if (patch.spot_end < patch.spot_start)
+				errx(1, "%s:%u: Invalid spot range", file, line);
+		} else {
+			errx(1, "%s:%u: Unknown directive '%s'", file, line, tok);
+		}
+	}
+	free(str);
+	fclose(fp);
+
+	for (unsigned x = 0; x != 128; x++) {
+		if (patch.note[x] > patch.num_leds)
+			errx(1, "%s: Note %u is bound to a missing fixture", file, x);
+	}
+}
+
+/*
+ * Map a binary PPM file holding one or more frames of equal size, as
+ * for example written by "ffmpeg -i clip.mp4 -f image2pipe -c:v ppm".
+ * Only the pages touched by the LED samples are ever read in.
+ */
+static void
+image_load(const char *file)
+{
+	const uint8_t *ptr;
+	const uint8_t *end;
+	unsigned long value[3];
+	struct stat st;
+	size_t header;
+	void *map;
+	int fd;
+
+	fd = open(file, O_RDONLY);
+	if (fd < 0)
+		err(1, "Cannot open '%s'", file);
+	if (fstat(fd, &st) != 0 || st.st_size < 2)
+		errx(1, "%s: Invalid file", file);
+	map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	if (map == MAP_FAILED)
+		err(1, "Cannot map '%s'", file);
+	close(fd);
+
+	ptr = map;
+	end = ptr + st.st_size;
+
+	if (ptr[0] != 'P' || ptr[1] != '6')
+		errx(1, "%s: Not a binary PPM file", file);
+	ptr += 2;
+
+	for (unsigned x = 0; x != 3; x++) {
+		while (ptr != end && (*ptr == '#' || *ptr <= ' ')) {
+			if (*ptr == '#') {
+				while (ptr != end && *ptr != '\n')
+					ptr++;
+			} else {
+				ptr++;
+			}
+		}
+		for (value[x] = 0; ptr != end && *ptr >= '0' && *ptr <= '9'; ptr++) {
+			value[x] = 10 * value[x] + *ptr - '0';
+			if (value[x] > 65535)
+				errx(1, "%s: Invalid PPM header", file);
+		}
+	}
+	if (ptr == end || value[0] == 0 || value[1] == 0 || value[2] != 255)
+		errx(1, "%s: Only 8-bit PPM files are supported", file);
+	ptr++;		/* single whitespace */
+
+	header = ptr - (const uint8_t *)map;
+
+	image.width = value[0];
+	image.height = value[1];
+	image.pixels = image.width * image.height;
+	image.stride = header + 3 * (size_t)image.pixels;
+	image.frames = st.st_size / image.stride;
+	image.data = ptr;
+
+	if (image.frames == 0)
+		errx(1, "%s: Truncated PPM file", file);
+
+#ifdef MADV_RANDOM
+	madvise(map, st.st_size, MADV_RANDOM);
+#endif
+}
+
+/*
+ * Use the compiled in picture, if any.
+ */
+static void
+image_builtin(void)
+{
+#ifdef HAVE_PICTURE
+	const char *src = header_data;
+	uint8_t *dst;
+
+	dst = malloc(3 * width * height);
+	if (dst == NULL)
+		errx(1, "Out of memory");
+
+	image.data = dst;
+	image.width = width;
+	image.height = height;
+	image.pixels = width * height;
+	image.stride = 3 * image.pixels;
+	image.frames = 1;
+
+	for (uint32_t x = 0; x != image.pixels; x++, dst += 3)
+		HEADER_PIXEL(src, dst);
+#endif
+}
+
+/*
+ * Precompute the pixel each LED samples, relative to the image
+ * position. By default the LEDs sample consecutive pixels.
+ */
+static void
+image_sample_init(void)
+{
+	if (image.data == NULL)
+		return;
+
+	image.sample = malloc(sizeof(image.sample[0]) * (patch.num_leds + 1));
+	if (image.sample == NULL)
+		errx(1, "Out of memory");
+
+	for (unsigned x = 0; x != patch.num_leds; x++) {
+		const int32_t pixel = patch.led[x].pixel;
+
+		if (pixel < 0)
+			image.sample[x] = x % image.pixels;
+		else
+			image.sample[x] = ((pixel & 0xFFFF) % image.width +
+			    ((pixel >> 16) % image.height) * image.width);
+	}
+}
+
+/*
+ * The port path identifies an interface across replugging, also when
+ * all units are of the same model.
+ */
+static void
+usb_port_save(struct martin_dev *dev, libusb_device *device)
+{
+	const int num = libusb_get_port_numbers(device, dev->port.path,
+	    sizeof(dev->port.path));
+
+	dev->port.bus = libusb_get_bus_number(device);
+	dev->port.num = (num < 0) ? 0 : num;
+}
+
+static int
+usb_port_match(const struct martin_dev *dev, libusb_device *device)
+{
+	uint8_t path[USB_PORTS_MAX];
+	const int num = libusb_get_port_numbers(device, path, sizeof(path));
+
+	return (num == dev->port.num &&
+	    libusb_get_bus_number(device) == dev->port.bus &&
+	    memcmp(path, dev->port.path, dev->port.num) == 0);
+}
+
+static void
+martin_dev_free(struct martin_dev *dev)
+{
+	/* freeing a NULL transfer is allowed */
+	for (unsigned x = 0; x != USB_TX_FRAMES; x++)
+		libusb_free_transfer(dev->tx[x].xfer);
+	libusb_free_transfer(dev->rx.xfer);
+	libusb_free_transfer(dev->setup.xfer);
+	free(dev->setup.data);
+	free(dev->record.frame);
+	free(dev);
+}
+
+static struct martin_dev *
+martin_dev_alloc(libusb_device_handle *devh)
+{
+	struct martin_dev *dev;
+	pthread_condattr_t attr;
+
+	dev = calloc(1, sizeof(*dev));
+	if (dev == NULL)
+		return (NULL);
+
+	for (unsigned x = 0; x != USB_TX_FRAMES; x++)
+		dev->tx[x].dev = dev;
+
+	if (devh != NULL) {
+		for (unsigned x = 0; x != USB_TX_FRAMES; x++) {
+			dev->tx[x].xfer = libusb_alloc_transfer(0);
+			if (dev->tx[x].xfer == NULL) {
+				martin_dev_free(dev);
+				return (NULL);
+			}
+		}
+		dev->rx.xfer = libusb_alloc_transfer(0);
+		if (dev->rx.xfer == NULL) {
+			martin_dev_free(dev);
+			return (NULL);
+		}
+	}
+
+	dev->unit = martin_num;
+	dev->devh = devh;
+	dev->tx_attached = 1;
+	dev->null_backend = (devh == NULL);
+	if (devh != NULL)
+		usb_port_save(dev, libusb_get_device(devh));
+	dev->stats = &stats->unit[martin_num];
+	dev->control.data.decay = 3.0;
+	dev->control.data.effect_bpm = EFFECT_BPM;
+	dev->control.data.effect_depth = 255;
+	dev->effect.idle = 1;
+	dev->universe.seq = 1;
+	dev->net_last.seq = 1;
+	if (record_file != NULL) {
+		dev->record.frame = malloc(sizeof(*dev->record.frame) * RECORD_QUEUE);
+		if (dev->record.frame == NULL) {
+			martin_dev_free(dev);
+			return (NULL);
+		}
+	}
+	if (universes != NULL)
+		dev->universe.map = &universes->unit[martin_num];
+	dev->alsa_ctl = dev->control.data;
+	dev->control_last = dev->control.data;
+	sampler_init(&dev->sampler, sampler_seed + martin_num);
+
+	if (leds_alloc(&dev->leds, patch.led, patch.num_leds) != 0) {
+		martin_dev_free(dev);
+		return (NULL);
+	}
+	pthread_mutex_init(&dev->tx_mtx, NULL);
+	pthread_mutex_init(&dev->frame_mtx, NULL);
+
+	pthread_condattr_init(&attr);
+	pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+	pthread_cond_init(&dev->frame_cond, &attr);
+	pthread_condattr_destroy(&attr);
+
+	return (dev);
+}
+
+/*
+ * Each ALSA sequencer port maps to one DMX universe.
+ */
+static struct martin_dev *
+alsa_port_to_dev(int port)
+{
+	for (unsigned x = 0; x != martin_num; x++) {
+		if (martin_dev[x]->alsa_port == port)
+			return (martin_dev[x]);
+	}
+	return (NULL);
+}
+
+/*
+ * Convert the time stamp of a sequencer event to CLOCK_MONOTONIC. The
+ * ports stamp every event with the real time of our queue when it is
+ * delivered, which is more precise than the time we get to read it.
+ */
+static uint64_t
+alsa_event_time(const snd_seq_event_t *ev)
+{
+	if ((ev->flags & SND_SEQ_TIME_STAMP_MASK) != SND_SEQ_TIME_STAMP_REAL ||
+	    ev->queue != alsa_queue)
+		return (monotonic_ns());
+
+	return (alsa_queue_base + ev->time.time.tv_sec * 1000000000ULL +
+	    ev->time.time.tv_nsec);
+}
+
+/*
+ * Handle all pending sequencer events as one batch. The sequencer is in
+ * non-blocking mode, so this returns when the input is drained.
+ */
+static void
+alsa_read(void)
+{
+	snd_seq_event_t *ev;
+
+	while (snd_seq_event_input(alsa_seq, &ev) >= 0) {
+		struct martin_dev *dev = alsa_port_to_dev(ev->dest.port);
+
+		if (dev == NULL)
+			goto next;
+
+		switch (ev->type) {
+		case SND_SEQ_EVENT_NOTEON:
+			if (ev->data.note.channel != 0)
+				break;
+			input_note(dev, ev->data.note.note, ev->data.note.velocity,
+			    alsa_event_time(ev));
+			break;
+		case SND_SEQ_EVENT_CLOCK:
+			input_clock(dev, alsa_event_time(ev));
+			break;
+		case SND_SEQ_EVENT_START:
+			input_start(dev, alsa_event_time(ev));
+			break;
+		case SND_SEQ_EVENT_CONTROLLER:
+#ifdef HAVE_DEBUG
+			printf("CONTROL EVENT %d %d\n", ev->data.control.param,
+			    ev->data.control.value);
+#endif
+			input_control(dev, ev->data.control.param, ev->data.control.value,
+			    alsa_event_time(ev));
+			break;
+
+		default:
+#ifdef HAVE_DEBUG
+			printf("UNKNOWN EVENT %d\n", ev->type);
+#endif
+			break;
+		}
+	next:
+		snd_seq_free_event(ev);
+	}
+	input_flush();
+}
+
+/*
+ * Start the queue used for time stamping input, and find the offset of
+ * its real time from CLOCK_MONOTONIC.
+ */
+static void
+alsa_queue_start(void)
+{
+	snd_seq_queue_status_t *status;
+	const snd_seq_real_time_t *rt;
+	uint64_t before;
+	uint64_t after;
+
+	alsa_queue = snd_seq_alloc_queue(alsa_seq);
+	if (alsa_queue < 0 ||
+	    snd_seq_start_queue(alsa_seq, alsa_queue, NULL) < 0 ||
+	    snd_seq_drain_output(alsa_seq) < 0 ||
+	    snd_seq_queue_status_malloc(&status) < 0) {
+		printf("Failed to start ALSA queue, events are not time stamped\n");
+		alsa_queue = -1;
+		return;
+	}
+
+	before = monotonic_ns();
+	snd_seq_get_queue_status(alsa_seq, alsa_queue, status);
+	after = monotonic_ns();
+
+	rt = snd_seq_queue_status_get_real_time(status);
+	alsa_queue_base = before + (after - before) / 2 -
+	    (rt->tv_sec * 1000000000ULL + rt->tv_nsec);
+	snd_seq_queue_status_free(status);
+}
+
+static int
+alsa_create_port(const char *name)
+{
+	snd_seq_port_info_t *info;
+	int port;
+
+	if (snd_seq_port_info_malloc(&info) < 0)
+		return (-1);
+
+	snd_seq_port_info_set_name(info, name);
+	snd_seq_port_info_set_capability(info,
+	    SND_SEQ_PORT_CAP_WRITE | SND_SEQ_PORT_CAP_SUBS_WRITE);
+	snd_seq_port_info_set_type(info,
+	    SND_SEQ_PORT_TYPE_MIDI_GENERIC | SND_SEQ_PORT_TYPE_APPLICATION);
+	snd_seq_port_info_set_midi_channels(info, 16);
+
+	if (alsa_queue >= 0) {
+		snd_seq_port_info_set_timestamping(info, 1);
+		snd_seq_port_info_set_timestamp_real(info, 1);
+		snd_seq_port_info_set_timestamp_queue(info, alsa_queue);
+	}
+
+	if (snd_seq_create_port(alsa_seq, info) < 0)
+		port = -1;
+	else
+		port = snd_seq_port_info_get_port(info);
+	snd_seq_port_info_free(info);
+
+	return (port);
+}
+
+static struct {
+	int	fd[NET_MAX];
+	struct mmsghdr msg[NET_BATCH];
+	struct iovec iov[NET_BATCH];
+	struct sockaddr_in addr[NET_BATCH];
+	uint8_t	data[NET_BATCH][NET_PACKET_MAX];
+}	net_rx = { .fd = { -1, -1 } };
+
+static struct martin_dev *
+net_universe_to_dev(int proto, unsigned universe)
+{
+	const unsigned unit = universe - net_universe[proto];
+
+	if (net_universe[proto] < 0 || unit >= martin_num)
+		return (NULL);
+	return (martin_dev[unit]);
+}
+
+static struct net_source *
+net_source_find(struct martin_dev *dev, const uint8_t *id)
+{
+	for (unsigned x = 0; x != NET_SOURCES; x++) {
+		struct net_source *src = dev->net_source + x;
+
+		if (src->expire != 0 && memcmp(src->id, id, sizeof(src->id)) == 0)
+			return (src);
+	}
+	return (NULL);
+}
+
+static void
+net_input(struct martin_dev *dev, const uint8_t *id, uint8_t priority,
+    const uint8_t *data, unsigned slots, uint64_t timeout, uint64_t now)
+{
+	static uint64_t serial;
+	struct net_source *src = net_source_find(dev, id);
+
+	for (unsigned x = 0; src == NULL && x != NET_SOURCES; x++) {
+		if (dev->net_source[x].expire == 0) {
+			src = dev->net_source + x;
+			memcpy(src->id, id, sizeof(src->id));
+		}
+	}
+	if (src == NULL)
+		return;		/* too many senders */
+
+	src->serial = ++serial;
+	src->expire = now + timeout;
+	src->priority = priority;
+	memcpy(src->data, data, slots);
+	memset(src->data + slots, 0, DMX_SLOTS - slots);
+
+	dev->input.net = 1;
+	dev->input.wake = 1;
+	input_pending(dev, now);
+}
+
+/*
+ * Art-Net ArtDmx packet, see the Art-Net 4 specification.
+ */
+static void
+net_artnet(const uint8_t *pkt, size_t len, const struct sockaddr_in *from, uint64_t now)
+{
+	struct martin_dev *dev;
+	uint8_t id[16] = {};
+	unsigned slots;
+
+	if (len < 18 || memcmp(pkt, "Art-Net", 8) != 0 ||
+	    pkt[8] != 0x00 || pkt[9] != 0x50 ||	/* OpDmx, little endian */
+	    ((pkt[10] << 8) | pkt[11]) < 14)
+		return;
+
+	dev = net_universe_to_dev(NET_ARTNET, pkt[14] | ((pkt[15] & 0x7F) << 8));
+	slots = (pkt[16] << 8) | pkt[17];
+	if (dev == NULL || slots > DMX_SLOTS || slots > len - 18)
+		return;
+
+	/* senders have no identity, so use their address */
+	memcpy(id, &from->sin_addr, sizeof(from->sin_addr));
+	memcpy(id + sizeof(from->sin_addr), &from->sin_port, sizeof(from->sin_port));
+
+	net_input(dev, id, 100, pkt + 18, slots, ARTNET_TIMEOUT, now);
+}
+
+/*
+ * sACN data packet, see ANSI E1.31. Only the fields needed to tell a
+ * DMX data packet apart are checked.
+ */
+static void
+net_sacn(const uint8_t *pkt, size_t len, const struct sockaddr_in *from, uint64_t now)
+{
+	static const uint8_t acn_id[12] = "ASC-E1.17\0\0";
+	struct martin_dev *dev;
+	struct net_source *src;
+	unsigned slots;
+
+	if (len < 126 || pkt[1] != 0x10 ||
+	    memcmp(pkt + 4, acn_id, sizeof(acn_id)) != 0 ||
+	    pkt[21] != 0x04 ||		/* VECTOR_ROOT_E131_DATA */
+	    pkt[43] != 0x02 ||		/* VECTOR_E131_DATA_PACKET */
+	    pkt[117] != 0x02 ||		/* VECTOR_DMP_SET_PROPERTY */
+	    pkt[125] != 0x00 ||		/* DMX start code */
+	    (pkt[112] & 0x80) != 0)	/* preview data */
+		return;
+
+	dev = net_universe_to_dev(NET_SACN, (pkt[113] << 8) | pkt[114]);
+	slots = ((pkt[123] << 8) | pkt[124]) - 1;
+	if (dev == NULL || slots > DMX_SLOTS || slots > len - 126)
+		return;
+
+	/* stream terminated */
+	if (pkt[112] & 0x40) {
+		src = net_source_find(dev, pkt + 22);
+		if (src != NULL) {
+			src->expire = 0;
+			dev->input.net = 1;
+			input_pending(dev, now);
+		}
+		return;
+	}
+	net_input(dev, pkt + 22, pkt[108], pkt + 126, slots, SACN_TIMEOUT, now);
+}
+
+static void
+net_open(int proto)
+{
+	const uint16_t port = (proto == NET_ARTNET) ? ARTNET_PORT : SACN_PORT;
+	struct sockaddr_in addr = {
+		.sin_family = AF_INET,
+		.sin_port = htons(port),
+		.sin_addr.s_addr = htonl(INADDR_ANY),
+	};
+	int one = 1;
+	int fd;
+
+	fd = socket(AF_INET, SOCK_DGRAM, 0);
+	if (fd < 0)
+		err(1, "Cannot create UDP socket");
+	setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+	if (bind(fd, (struct sockaddr *)&addr, sizeof(addr)) != 0)
+		err(1, "Cannot bind UDP port %u", port);
+
+	/* sACN universes are multicast to 239.255.<universe> */
+	for (unsigned x = 0; proto == NET_SACN && x != martin_num; x++) {
+		struct ip_mreq mreq = {
+			.imr_multiaddr.s_addr = htonl(0xEFFF0000 | ((net_universe[proto] + x) & 0xFFFF)),
+			.imr_interface.s_addr = htonl(INADDR_ANY),
+		};
+
+		if (setsockopt(fd, IPPROTO_IP, IP_ADD_MEMBERSHIP, &mreq, sizeof(mreq)) != 0)
+			printf("Cannot join sACN universe %u, unicast only\n", net_universe[proto] + x);
+	}
+	net_rx.fd[proto] = fd;
+
+	for (unsigned x = 0; x != NET_BATCH; x++) {
+		net_rx.iov[x].iov_base = net_rx.data[x];
+		net_rx.iov[x].iov_len = NET_PACKET_MAX;
+		net_rx.msg[x].msg_hdr.msg_name = &net_rx.addr[x];
+		net_rx.msg[x].msg_hdr.msg_iov = &net_rx.iov[x];
+		net_rx.msg[x].msg_hdr.msg_iovlen = 1;
+	}
+}
+
+/*
+ * Receive all pending datagrams, NET_BATCH per system call, and parse
+ * them in place.
+ */
+static void
+net_read(int proto)
+{
+	int n;
+
+	do {
+		uint64_t now;
+
+		for (unsigned x = 0; x != NET_BATCH; x++)
+			net_rx.msg[x].msg_hdr.msg_namelen = sizeof(net_rx.addr[x]);
+
+		n = recvmmsg(net_rx.fd[proto], net_rx.msg, NET_BATCH, MSG_DONTWAIT, NULL);
+		now = monotonic_ns();
+
+		for (int x = 0; x < n; x++) {
+			if (proto == NET_ARTNET)
+				net_artnet(net_rx.data[x], net_rx.msg[x].msg_len, &net_rx.addr[x], now);
+			else
+				net_sacn(net_rx.data[x], net_rx.msg[x].msg_len, &net_rx.addr[x], now);
+		}
+	} while (n == NET_BATCH);
+
+	input_flush();
+}
+
+/*
+ * Drop the senders which timed out.
+ */
+static void
+net_expire(uint64_t now)
+{
+	for (unsigned x = 0; x != martin_num; x++) {
+		struct martin_dev *dev = martin_dev[x];
+		uint8_t expired = 0;
+
+		for (unsigned y = 0; y != NET_SOURCES; y++) {
+			if (dev->net_source[y].expire == 0 ||
+			    dev->net_source[y].expire > now)
+				continue;
+			dev->net_source[y].expire = 0;
+			expired = 1;
+		}
+		if (expired)
+			net_publish(dev);
+	}
+}
+
+static void
+usb_pollfd_added(int fd, short events, void *arg)
+{
+	atomic_store(&usb_pollfd_changed, 1);
+}
+
+static void
+usb_pollfd_removed(int fd, void *arg)
+{
+	atomic_store(&usb_pollfd_changed, 1);
+}
+
+/*
+ * Hot plug. Interfaces which disappear are closed once their transfers
+ * have finished, and interfaces which appear are given to an unplugged
+ * unit. Units are only created at startup. The LibUSB callbacks run in
+ * the event loop, which opens the devices after them.
+ */
+static libusb_device *usb_arrived[MAX_DEVICES];
+static unsigned usb_num_arrived;
+static uint64_t usb_scan_time;
+
+static int
+usb_hotplug_callback(libusb_context *ctx, libusb_device *device,
+    libusb_hotplug_event event, void *arg)
+{
+	if (event == LIBUSB_HOTPLUG_EVENT_DEVICE_LEFT) {
+		for (unsigned x = 0; x != martin_num; x++) {
+			struct martin_dev *dev = martin_dev[x];
+
+			if (dev->devh != NULL && libusb_get_device(dev->devh) == device)
+				dev->gone = 1;
+		}
+	} else if (usb_num_arrived != MAX_DEVICES) {
+		usb_arrived[usb_num_arrived++] = libusb_ref_device(device);
+	}
+	return (0);
+}
+
+static void
+usb_detach(struct martin_dev *dev)
+{
+	switch (dev->state) {
+	case UNIT_RUNNING:
+		pthread_mutex_lock(&dev->tx_mtx);
+		dev->tx_attached = 0;
+		for (unsigned x = 0; x != USB_TX_FRAMES; x++) {
+			if (dev->tx[x].busy)
+				libusb_cancel_transfer(dev->tx[x].xfer);
+		}
+		pthread_mutex_unlock(&dev->tx_mtx);
+
+		if (dev->rx.active)
+			libusb_cancel_transfer(dev->rx.xfer);
+		dev->state = UNIT_CLOSING;
+		printf("USB UNIT %u DISCONNECTED\n", dev->unit);
+		break;
+	case UNIT_SETUP:
+		/* the callback moves on to UNIT_CLOSING */
+		if (dev->setup.active)
+			libusb_cancel_transfer(dev->setup.xfer);
+		break;
+	default:
+		break;
+	}
+}
+
+/*
+ * Give an interface to an unplugged unit, preferably the one which was
+ * at the same port. If "exact" is set, only to that one.
+ */
+static void
+usb_attach(libusb_device *device, int exact)
+{
+	struct libusb_device_descriptor desc;
+	libusb_device_handle *devh;
+	struct martin_dev *dev = NULL;
+
+	if (libusb_get_device_descriptor(device, &desc) != 0 ||
+	    desc.idVendor != USB_VENDOR ||
+	    desc.idProduct != USB_PRODUCT)
+		return;
+
+	for (unsigned x = 0; x != martin_num; x++) {
+		if (martin_dev[x]->devh != NULL &&
+		    libusb_get_device(martin_dev[x]->devh) == device)
+			return;
+	}
+	for (unsigned x = 0; x != martin_num; x++) {
+		if (martin_dev[x]->state != UNIT_DETACHED)
+			continue;
+		if (dev == NULL && exact == 0)
+			dev = martin_dev[x];
+		if (usb_port_match(martin_dev[x], device)) {
+			dev = martin_dev[x];
+			break;
+		}
+	}
+	if (dev == NULL)
+		return;
+
+	if (dev->setup.xfer == NULL)
+		dev->setup.xfer = libusb_alloc_transfer(0);
+	if (dev->setup.data == NULL)
+		dev->setup.data = malloc(LIBUSB_CONTROL_SETUP_SIZE + SETUP_DATA_MAX);
+	if (dev->setup.xfer == NULL || dev->setup.data == NULL)
+		return;
+
+	if (libusb_open(device, &devh) != 0)
+		return;
+	if (libusb_claim_interface(devh, 0) < 0 ||
+	    libusb_set_interface_alt_setting(devh, 0, 1) < 0) {
+		libusb_close(devh);
+		return;
+	}
+	dev->devh = devh;
+	usb_port_save(dev, device);
+	usb_setup_start(dev);
+}
+
+/*
+ * Called by the event loop after every wakeup. Returns non-zero while
+ * a unit is unplugged.
+ */
+static int
+usb_hotplug_service(uint64_t now)
+{
+	int detached = 0;
+
+	for (unsigned x = 0; x != martin_num; x++) {
+		struct martin_dev *dev = martin_dev[x];
+		int busy = 0;
+
+		if (dev->gone) {
+			dev->gone = 0;
+			usb_detach(dev);
+		}
+		if (dev->state == UNIT_CLOSING) {
+			pthread_mutex_lock(&dev->tx_mtx);
+			for (unsigned y = 0; y != USB_TX_FRAMES; y++)
+				busy |= dev->tx[y].busy;
+			pthread_mutex_unlock(&dev->tx_mtx);
+
+			if (busy == 0 && dev->rx.active == 0 && dev->setup.active == 0) {
+				libusb_close(dev->devh);
+				dev->devh = NULL;
+				dev->state = UNIT_DETACHED;
+			}
+		}
+		if (dev->state == UNIT_DETACHED)
+			detached = 1;
+	}
+
+	while (usb_num_arrived != 0) {
+		libusb_device *device = usb_arrived[--usb_num_arrived];
+
+		usb_attach(device, 0);
+		libusb_unref_device(device);
+	}
+
+	/* without hot plug support, and after a failed init sequence */
+	if (detached && now - usb_scan_time >= USB_RESCAN) {
+		libusb_device **list;
+		ssize_t num;
+
+		usb_scan_time = now;
+		num = libusb_get_device_list(usb_ctx, &list);
+		for (int exact = 1; exact >= 0; exact--) {
+			for (ssize_t x = 0; x < num; x++)
+				usb_attach(list[x], exact);
+		}
+		if (num >= 0)
+			libusb_free_device_list(list, 1);
+	}
+	return (detached);
+}
+
+/*
+ * Serve the ALSA sequencer and all USB completions from one thread,
+ * by polling on the file descriptors of both libraries. The writer
+ * threads only submit transfers.
+ */
+static void
+event_loop(void)
+{
+	struct pollfd fds[EVENT_FDS_MAX];
+	int net_fd[NET_MAX];
+	int alsa_nfds;
+	int base_nfds;
+	int nfds = 0;
+	int detached = 0;
+
+	snd_seq_nonblock(alsa_seq, 1);
+	alsa_nfds = snd_seq_poll_descriptors(alsa_seq, fds, EVENT_FDS_MAX, POLLIN);
+	if (alsa_nfds < 0)
+		errx(1, "Cannot poll the ALSA sequencer");
+
+	base_nfds = alsa_nfds;
+	for (int x = 0; x != NET_MAX; x++) {
+		net_fd[x] = -1;
+		if (net_rx.fd[x] < 0)
+			continue;
+		net_fd[x] = base_nfds;
+		fds[base_nfds].fd = net_rx.fd[x];
+		fds[base_nfds].events = POLLIN;
+		base_nfds++;
+	}
+
+	libusb_set_pollfd_notifiers(usb_ctx, &usb_pollfd_added,
+	    &usb_pollfd_removed, NULL);
+
+	while (1) {
+		struct timeval tv;
+		int timeout = -1;
+		int ret;
+
+		if (atomic_exchange(&usb_pollfd_changed, 0)) {
+			const struct libusb_pollfd **usb_fds = libusb_get_pollfds(usb_ctx);
+
+			nfds = base_nfds;
+			for (unsigned x = 0; usb_fds != NULL && usb_fds[x] != NULL; x++) {
+				if (nfds == EVENT_FDS_MAX)
+					errx(1, "Too many LibUSB file descriptors");
+				fds[nfds].fd = usb_fds[x]->fd;
+				fds[nfds].events = usb_fds[x]->events;
+				nfds++;
+			}
+			libusb_free_pollfds(usb_fds);
+		}
+
+		/* LibUSB may need to time out transfers by itself */
+		if (libusb_get_next_timeout(usb_ctx, &tv) == 1)
+			timeout = tv.tv_sec * 1000 + (tv.tv_usec + 999) / 1000;
+
+		/* network senders time out by themselves, unplugged units are rescanned */
+		if ((base_nfds != alsa_nfds || detached) && (timeout < 0 || timeout > 1000))
+			timeout = 1000;
+
+		ret = poll(fds, nfds, timeout);
+		if (ret < 0) {
+			if (errno == EINTR)
+				continue;
+			err(1, "poll");
+		}
+
+		for (int x = base_nfds; x != nfds; x++) {
+			if (fds[x].revents != 0 || ret == 0) {
+				tv = (struct timeval){};
+				libusb_handle_events_timeout(usb_ctx, &tv);
+				break;
+			}
+		}
+		for (int x = 0; x != alsa_nfds; x++) {
+			if (fds[x].revents != 0) {
+				alsa_read();
+				break;
+			}
+		}
+		for (int x = 0; x != NET_MAX; x++) {
+			if (net_fd[x] >= 0 && fds[net_fd[x]].revents != 0)
+				net_read(x);
+		}
+		if (base_nfds != alsa_nfds)
+			net_expire(monotonic_ns());
+		detached = usb_hotplug_service(monotonic_ns());
+	}
+}
+
+/*
+ * Benchmark mode. Render and convert frames for a number of null
+ * universes as fast as possible, and report the time spent per stage.
+ */
+enum {
+	STAGE_INPUT,
+	STAGE_RENDER,
+	STAGE_CONVERT,
+	STAGE_JOIN,
+	STAGE_SUBMIT,
+	STAGE_MAX,
+};
+
+static const char *const stage_name[STAGE_MAX] = {
+	[STAGE_INPUT] = "input",
+	[STAGE_RENDER] = "render",
+	[STAGE_CONVERT] = "convert",
+	[STAGE_JOIN] = "join",
+	[STAGE_SUBMIT] = "submit",
+};
+
+struct bench_unit {
+	struct martin_dev *dev;
+	pthread_t thread;
+	unsigned frames;
+	uint32_t *build;		/* per frame, ns */
+	uint64_t stage[STAGE_MAX];	/* ns */
+	uint8_t	buffer[DMX_SLOTS + 1];
+	uint8_t	sent[DMX_SLOTS];
+};
+
+/*
+ * Build and submit frame "n" of one universe, as the writer does.
+ */
+static void
+bench_frame(struct bench_unit *bu, unsigned n)
+{
+	struct martin_dev *dev = bu->dev;
+	struct control ctl;
+	struct usb_tx *tx;
+	uint64_t t[STAGE_MAX + 1];
+	int length;
+
+	/* one note-on per frame, through the same queue as MIDI */
+	if (patch.num_leds != 0 &&
+	    trigger_enqueue(dev, n % patch.num_leds, 64, 0) != 0)
+		stats_add(&dev->stats->input_dropped, 1);
+
+	t[0] = monotonic_ns();
+	control_snapshot(dev, &ctl);
+	trigger_dequeue(dev, UINT64_MAX);
+	t[1] = monotonic_ns();
+	render(dev, bu->buffer, &ctl);
+	effect_render(dev, &ctl, t[1]);
+	quantise(dev, bu->buffer);
+	t[2] = monotonic_ns();
+	tx = usb_tx_get(dev);
+	if (usb_tx_delta) {
+		length = convert_delta(bu->buffer, bu->sent, tx->data,
+		    (n % frame_rate) == 0);
+	} else {
+		convert(bu->buffer, tx->data);
+		length = USB_PACKET_SIZE;
+	}
+	t[3] = monotonic_ns();
+	if (frame_lockstep)
+		frame_join_wait(0);
+	t[4] = monotonic_ns();
+	usb_tx_submit(tx, length);
+	t[5] = monotonic_ns();
+
+	for (unsigned x = 0; x != STAGE_MAX; x++)
+		bu->stage[x] += t[x + 1] - t[x];
+	bu->build[n] = t[3] - t[0];
+}
+
+static void *
+bench_loop(void *arg)
+{
+	struct bench_unit *bu = arg;
+
+	for (unsigned n = 0; n != bu->frames; n++)
+		bench_frame(bu, n);
+	return (NULL);
+}
+
+static int
+bench_compare(const void *a, const void *b)
+{
+	const uint32_t *pa = a;
+	const uint32_t *pb = b;
+
+	return ((*pa > *pb) - (*pa < *pb));
+}
+
+/*
+ * Replace the patch by "num" packed RGBI fixtures.
+ */
+static void
+bench_patch(unsigned num)
+{
+	free(patch.led);
+	patch.led = calloc(num, sizeof(patch.led[0]));
+	if (patch.led == NULL)
+		errx(1, "Out of memory");
+	patch.num_leds = num;
+
+	for (unsigned x = 0; x != num; x++) {
+		for (unsigned ch = 0; ch != CH_MAX; ch++) {
+			patch.led[x].offset[ch] = (4 * x + ch) % DMX_SLOTS;
+			patch.led[x].fine[ch] = DMX_SLOT_NONE;
+		}
+		patch.led[x].pixel = -1;
+	}
+	memset(patch.note, 0, sizeof(patch.note));
+	for (unsigned x = 0; x != 128 && x != num; x++)
+		patch.note[x] = x + 1;
+}
+
+/*
+ * Use a generated gradient when no picture is available.
+ */
+static void
+bench_image(void)
+{
+	uint8_t *ptr;
+
+	image.width = 64;
+	image.height = 64;
+	image.pixels = image.width * image.height;
+	image.stride = 3 * image.pixels;
+	image.frames = 1;
+
+	ptr = malloc(image.stride);
+	if (ptr == NULL)
+		errx(1, "Out of memory");
+	image.data = ptr;
+
+	for (uint32_t y = 0; y != image.height; y++) {
+		for (uint32_t x = 0; x != image.width; x++) {
+			*ptr++ = 4 * x;
+			*ptr++ = 4 * y;
+			*ptr++ = 2 * (x + y);
+		}
+	}
+}
+
+static int
+bench_run(unsigned frames, unsigned units)
+{
+	struct bench_unit *bench;
+	uint64_t stage[STAGE_MAX] = {};
+	uint32_t *build;
+	uint64_t start;
+	uint64_t total;
+	size_t count = (size_t)frames * units;
+
+	build = malloc(sizeof(build[0]) * count);
+	bench = calloc(units, sizeof(bench[0]));
+	if (build == NULL || bench == NULL)
+		errx(1, "Out of memory");
+
+	for (martin_num = 0; martin_num != units; martin_num++) {
+		martin_dev[martin_num] = martin_dev_alloc(NULL);
+		if (martin_dev[martin_num] == NULL)
+			errx(1, "Out of memory");
+		update_pixel_speed(martin_dev[martin_num], 0.5f);
+
+		bench[martin_num].dev = martin_dev[martin_num];
+		bench[martin_num].frames = frames;
+		bench[martin_num].build = build + (size_t)martin_num * frames;
+
+		/* a chase over all fixtures */
+		martin_dev[martin_num]->control.data.effect_wave = WAVE_SINE;
+		martin_dev[martin_num]->control.data.effect_spread = 8;
+	}
+	stats->units = units;
+
+	printf("Benchmark: %u frames, %u universe(s), %u fixture(s), %s, %s%s\n",
+	    frames, units, patch.num_leds, usb_tx_delta ? "delta" : "full",
+#ifdef HAVE_FIXED_POINT
+	    "fixed point",
+#else
+	    "float",
+#endif
+	    frame_lockstep ? ", lockstep" : "");
+
+	start = monotonic_ns();
+
+	if (frame_lockstep) {
+		/* one thread per universe, as the writers */
+		frame_join.num = units;
+		for (unsigned u = 0; u != units; u++) {
+			if (pthread_create(&bench[u].thread, NULL, &bench_loop, bench + u) != 0)
+				errx(1, "Cannot create the benchmark thread of unit %u", u);
+		}
+		for (unsigned u = 0; u != units; u++)
+			pthread_join(bench[u].thread, NULL);
+	} else {
+		for (unsigned n = 0; n != frames; n++) {
+			for (unsigned u = 0; u != units; u++)
+				bench_frame(bench + u, n);
+		}
+	}
+
+	total = monotonic_ns() - start;
+
+	for (unsigned u = 0; u != units; u++) {
+		for (unsigned x = 0; x != STAGE_MAX; x++)
+			stage[x] += bench[u].stage[x];
+	}
+
+	qsort(build, count, sizeof(build[0]), &bench_compare);
+
+	printf("%.1f frames/s, %.1f ns/frame\n",
+	    count * 1E9 / total, (double)total / count);
+	for (unsigned x = 0; x != STAGE_MAX; x++)
+		printf("  %-8s %8.1f ns\n", stage_name[x], (double)stage[x] / count);
+	printf("  build p50 %u ns, p99 %u ns, max %u ns\n",
+	    build[count / 2], build[count * 99 / 100], build[count - 1]);
+
+	free(build);
+	free(bench);
+	return (0);
+}
+
+static void
+usage(void)
+{
+	fprintf(stderr,
+	    "Usage: martin-usb-dmx [-f <fps>] [-i] [-s <ms>] [-l <ms>] [-d] [-q] [-p <patch>] [-I <image>] [-S <seed>] [-D] [-m <name>]\n"
+	    "                      [-A <universe>] [-e <universe>] [-M htp|ltp] [-U <name>]\n"
+	    "                      [-P <prio>] [-c <cpu,...>] [-E <cpu>] [-L] [-J] [-r <file>] [-n <units>] [-C <file>]\n"
+	    "       martin-usb-dmx -R <file> [-F] [options]\n"
+	    "       martin-usb-dmx -b <frames> [-u <universes>] [-N <fixtures>] [options]\n"
+	    "\t-f <fps>  DMX frame rate, 1..%d (default %d)\n"
+	    "\t-i        immediate mode, send a frame on every MIDI event\n"
+	    "\t-s <ms>   minimum spacing between frames in immediate mode\n"
+	    "\t-l <ms>   play notes this long after their time stamp, for steady timing\n"
+	    "\t-d        only send changed DMX slots, refreshing all once a second\n"
+	    "\t-q        quick init, skip redundant setup requests and retry on timeout\n"
+	    "\t-p <file> load the fixture patch from file\n"
+	    "\t-I <file> sample the LEDs from a binary PPM image or clip\n"
+	    "\t-S <seed> seed for the image walk, to reproduce a show\n"
+	    "\t-D        dither the LED levels over frames, for smoother fades\n"
+	    "\t-A <univ> receive Art-Net, starting at this universe for the first unit\n"
+	    "\t-e <univ> receive sACN (E1.31), starting at this universe for the first unit\n"
+	    "\t-M <mode> merge network senders highest (htp, default) or latest (ltp) first\n"
+	    "\t-U <name> accept DMX frames from other processes in a shared memory object\n"
+	    "\t-P <prio> run the writers under SCHED_FIFO at this priority\n"
+	    "\t-c <cpus> pin the writers to these CPUs, round robin\n"
+	    "\t-E <cpu>  pin the event loop to this CPU\n"
+	    "\t-L        lock all memory with mlockall()\n"
+	    "\t-J        send all units in lockstep, on one frame grid\n"
+	    "\t-n <n>    use at most n interfaces (default %d)\n"
+	    "\t-C <file> read options from file, one long name and argument per line\n"
+	    "\t-m <name> export statistics as a shared memory object, e.g. /martin-usb-dmx\n"
+	    "\t-r <file> record all packets sent, with their timing\n"
+	    "\t-R <file> send a recording instead of rendering, then exit\n"
+	    "\t-F        replay as fast as possible, not at the recorded timing\n"
+	    "\t-b <n>    benchmark rendering n frames without hardware\n"
+	    "\t-u <n>    number of universes to benchmark (default 1)\n"
+	    "\t-N <n>    benchmark n packed RGBI fixtures instead of the patch\n",
+	    FPS_MAX, FPS, MAX_DEVICES);
+	exit(1);
+}
+
+/*
+ * Real-time scheduling. All of it is best effort: when privileges are
+ * missing, a warning is printed and the default is used.
+ */
+static int
+rt_cpu_parse(const char *str)
+{
+	char *end;
+	long cpu = strtol(str, &end, 0);
+
+	if (end == str || cpu < 0 || cpu >= CPU_SETSIZE)
+		return (-1);
+	return (cpu);
+}
+
+static void
+rt_pin(pthread_t thread, int cpu, const char *what)
+{
+	cpu_set_t set;
+
+	if (cpu < 0)
+		return;
+	CPU_ZERO(&set);
+	CPU_SET(cpu, &set);
+
+	if (pthread_setaffinity_np(thread, sizeof(set), &set) != 0)
+		printf("Cannot pin the %s to CPU %d, continuing unpinned\n", what, cpu);
+}
+
+static void
+rt_writer_start(struct martin_dev *dev)
+{
+	const struct sched_param param = { .sched_priority = rt_priority };
+	pthread_attr_t attr;
+	pthread_t thread;
+	int error;
+
+	pthread_attr_init(&attr);
+	if (rt_priority != 0) {
+		pthread_attr_setinheritsched(&attr, PTHREAD_EXPLICIT_SCHED);
+		pthread_attr_setschedpolicy(&attr, SCHED_FIFO);
+		pthread_attr_setschedparam(&attr, &param);
+	}
+	error = pthread_create(&thread, &attr, &usb_write_loop, dev);
+	if (error == EPERM) {
+		printf("No permission for SCHED_FIFO on unit %u, using the default policy\n",
+		    dev->unit);
+		error = pthread_create(&thread, NULL, &usb_write_loop, dev);
+	}
+	pthread_attr_destroy(&attr);
+
+	if (error != 0)
+		errx(1, "Cannot create the writer thread of unit %u", dev->unit);
+
+	if (rt_num_cpu_writer != 0)
+		rt_pin(thread, rt_cpu_writer[dev->unit % rt_num_cpu_writer], "writer");
+}
+
+static const char option_string[] = "f:is:l:dqp:I:S:DA:e:M:U:m:r:R:FP:c:E:LJb:u:N:C:n:h";
+
+static unsigned bench_frames;
+static unsigned bench_units = 1;
+static unsigned bench_fixtures;
+
+static void config_load(const char *);
+
+/*
+ * Apply one option, from the command line or from a configuration
+ * file. Returns non-zero when the argument is invalid.
+ */
+static int
+option_set(int c, char *arg)
+{
+	switch (c) {
+	case 'f':
+		frame_rate = atoi(arg);
+		if (frame_rate < 1 || frame_rate > FPS_MAX)
+			return (-1);
+		break;
+	case 'i':
+		frame_immediate = 1;
+		break;
+	case 'd':
+		usb_tx_delta = 1;
+		break;
+	case 'q':
+		usb_setup_fast = 1;
+		break;
+	case 'p':
+		patch_load(arg);
+		break;
+	case 'I':
+		image_load(arg);
+		break;
+	case 'S':
+		sampler_seed = strtoull(arg, NULL, 0);
+		break;
+	case 'D':
+		dither = 1;
+		break;
+	case 'A':
+		net_universe[NET_ARTNET] = atoi(arg);
+		if (net_universe[NET_ARTNET] < 0 ||
+		    net_universe[NET_ARTNET] > 0x7FFF - MAX_DEVICES)
+			return (-1);
+		break;
+	case 'e':
+		net_universe[NET_SACN] = atoi(arg);
+		if (net_universe[NET_SACN] < 1 ||
+		    net_universe[NET_SACN] > 63999 - MAX_DEVICES)
+			return (-1);
+		break;
+	case 'M':
+		if (strcmp(arg, "htp") == 0)
+			net_merge = NET_HTP;
+		else if (strcmp(arg, "ltp") == 0)
+			net_merge = NET_LTP;
+		else
+			return (-1);
+		break;
+	case 'U':
+		universe_open(arg);
+		break;
+	case 'm':
+		stats_open(arg);
+		break;
+	case 'r':
+		record_open(arg);
+		break;
+	case 'R':
+		replay_file = arg;
+		break;
+	case 'F':
+		replay_fast = 1;
+		break;
+	case 'P':
+		rt_priority = atoi(arg);
+		if (rt_priority < sched_get_priority_min(SCHED_FIFO) ||
+		    rt_priority > sched_get_priority_max(SCHED_FIFO))
+			return (-1);
+		break;
+	case 'c':
+		rt_num_cpu_writer = 0;
+		for (char *ptr = arg; ptr != NULL; ptr = strchr(ptr, ',')) {
+			ptr += (*ptr == ',');
+			if (rt_num_cpu_writer == MAX_DEVICES)
+				return (-1);
+			rt_cpu_writer[rt_num_cpu_writer] = rt_cpu_parse(ptr);
+			if (rt_cpu_writer[rt_num_cpu_writer++] < 0)
+				return (-1);
+		}
+		break;
+	case 'E':
+		rt_cpu_event = rt_cpu_parse(arg);
+		if (rt_cpu_event < 0)
+			return (-1);
+		break;
+	case 'L':
+		rt_mlock = 1;
+		break;
+	case 'J':
+		frame_lockstep = 1;
+		break;
+	case 'n':
+		usb_max_units = atoi(arg);
+		if (usb_max_units < 1 || usb_max_units > MAX_DEVICES)
+			return (-1);
+		break;
+	case 'C':
+		config_load(arg);
+		break;
+	case 'b':
+		bench_frames = atoi(arg);
+		break;
+	case 'u':
+		bench_units = atoi(arg);
+		if (bench_units < 1 || bench_units > MAX_DEVICES)
+			return (-1);
+		break;
+	case 'N':
+		bench_fixtures = atoi(arg);
+		if (bench_fixtures < 1 || bench_fixtures > DMX_SLOTS)
+			return (-1);
+		break;
+	case 's':
+		if (atoi(arg) < 0)
+			return (-1);
+		frame_spacing = atoi(arg) * 1000000ULL;
+		break;
+	case 'l':
+		if (atoi(arg) < 0)
+			return (-1);
+		input_latency = atoi(arg) * 1000000ULL;
+		break;
+	default:
+		return (-1);
+	}
+	return (0);
+}
+
+/*
+ * Long names of the options which can be given in a configuration
+ * file. Replay and benchmark runs are command line only.
+ */
+static const struct {
+	const char *name;
+	char	option;
+}	config_option[] = {
+	{ "fps", 'f' },
+	{ "immediate", 'i' },
+	{ "spacing", 's' },
+	{ "latency", 'l' },
+	{ "delta", 'd' },
+	{ "quick", 'q' },
+	{ "patch", 'p' },
+	{ "image", 'I' },
+	{ "seed", 'S' },
+	{ "dither", 'D' },
+	{ "units", 'n' },
+	{ "artnet", 'A' },
+	{ "sacn", 'e' },
+	{ "merge", 'M' },
+	{ "shm_universes", 'U' },
+	{ "stats", 'm' },
+	{ "record", 'r' },
+	{ "priority", 'P' },
+	{ "cpus", 'c' },
+	{ "event_cpu", 'E' },
+	{ "mlock", 'L' },
+	{ "lockstep", 'J' },
+};
+
+/*
+ * Load options from a file. Each line holds the long name of an option
+ * and its argument, if any:
+ *
+ *	fps 44
+ *	delta
+ *	patch /usr/local/etc/show.patch
+ *
+ * Options are applied in order, so that command line options after -C
+ * override the file.
+ */
+static void
+config_load(const char *file)
+{
+	unsigned line = 0;
+	char *str = NULL;
+	size_t size = 0;
+	FILE *fp;
+
+	fp = fopen(file, "r");
+	if (fp == NULL)
+		err(1, "Cannot open '%s'", file);
+
+	while (getline(&str, &size, fp) > 0) {
+		const char *opt;
+		char *ptr;
+		char *tok;
+		char *arg;
+		unsigned x;
+
+		line++;
+		str[strcspn(str, "#\r\n")] = 0;
+
+		tok = strtok_r(str, " \t", &ptr);
+		if (tok == NULL)
+			continue;
+		for (x = 0; x != sizeof(config_option) / sizeof(config_option[0]); x++) {
+			if (strcmp(tok, config_option[x].name) == 0)
+				break;
+		}
+		if (x == sizeof(config_option) / sizeof(config_option[0]))
+			errx(1, "%s:%u: Unknown option '%s'", file, line, tok);
+
+		/* the same arguments as on the command line */
+		opt = strchr(option_string, config_option[x].option);
+		arg = strtok_r(NULL, " \t", &ptr);
+		if ((opt[1] == ':') != (arg != NULL) || strtok_r(NULL, " \t", &ptr) != NULL)
+			errx(1, "%s:%u: Wrong number of arguments", file, line);
+		if (option_set(config_option[x].option, arg) != 0)
+			errx(1, "%s:%u: Invalid argument for '%s'", file, line, tok);
+	}
+	free(str);
+	fclose(fp);
+}
+
+int
+main(int argc, char **argv)
+
+{
+	libusb_device **list;
+	ssize_t num;
+	int setup_error[MAX_DEVICES];
+	int err;
+	int c;
+
+	patch_default();
+	wave_init();
+	sampler_seed = arc4random();
+
+	while ((c = getopt(argc, argv, option_string)) != -1) {
+		if (option_set(c, optarg) != 0)
+			usage();
+	}
+
+	if (frame_lockstep && frame_immediate)
+		errx(1, "Lockstep mode cannot be combined with immediate mode");
+
+	stats->magic = MARTIN_STATS_MAGIC;
+	if (universes != NULL)
+		universes->magic = MARTIN_UNIVERSE_MAGIC;
+	stats->start = monotonic_ns();
+
+	if (image.data == NULL)
+		image_builtin();
+
+	if (bench_frames != 0) {
+		if (bench_fixtures != 0)
+			bench_patch(bench_fixtures);
+		if (image.data == NULL)
+			bench_image();
+		image_sample_init();
+		return (bench_run(bench_frames, bench_units));
+	}
+	image_sample_init();
+
+	if (libusb_init(&usb_ctx) != 0) {
+		printf("Failed to initialize LibUSB\n");
+		return (1);
+	}
+
+	num = libusb_get_device_list(usb_ctx, &list);
+	for (ssize_t x = 0; x < num && martin_num != usb_max_units; x++) {
+		struct libusb_device_descriptor desc;
+		libusb_device_handle *devh;
+
+		if (libusb_get_device_descriptor(list[x], &desc) != 0 ||
+		    desc.idVendor != USB_VENDOR ||
+		    desc.idProduct != USB_PRODUCT)
+			continue;
+		if (libusb_open(list[x], &devh) != 0)
+			continue;
+		if (libusb_claim_interface(devh, 0) < 0 ||
+		    libusb_set_interface_alt_setting(devh, 0, 1) < 0 ||
+		    (martin_dev[martin_num] = martin_dev_alloc(devh)) == NULL) {
+			libusb_close(devh);
+			continue;
+		}
+		martin_num++;
+	}
+	stats->units = martin_num;
+	if (universes != NULL)
+		universes->units = martin_num;
+	if (num >= 0)
+		libusb_free_device_list(list, 1);
+
+	/* without it, unplugged units are found by scanning */
+	if (libusb_has_capability(LIBUSB_CAP_HAS_HOTPLUG) &&
+	    libusb_hotplug_register_callback(usb_ctx,
+	    LIBUSB_HOTPLUG_EVENT_DEVICE_ARRIVED | LIBUSB_HOTPLUG_EVENT_DEVICE_LEFT,
+	    0, USB_VENDOR, USB_PRODUCT, LIBUSB_HOTPLUG_MATCH_ANY,
+	    &usb_hotplug_callback, NULL, NULL) != 0)
+		printf("Cannot register for USB hot plug events, scanning instead\n");
+
+	if (martin_num == 0) {
+		printf("No Martin USB DMX device found\n");
+		return (1);
+	}
+
+	/* output is needed to control the queue */
+	err = snd_seq_open(&alsa_seq, "default", SND_SEQ_OPEN_DUPLEX, 0);
+	if (err < 0) {
+		printf("Failed to open ALSA sequencer\n");
+		return (1);
+	}
+	snd_seq_set_client_name(alsa_seq, "Martin USB DMX");
+	alsa_queue_start();
+
+	for (unsigned x = 0; x != martin_num; x++) {
+		char name[16];
+
+		if (x == 0)
+			snprintf(name, sizeof(name), "port");
+		else
+			snprintf(name, sizeof(name), "port %u", x);
+
+		martin_dev[x]->alsa_port = alsa_create_port(name);
+	}
+
+	/* the init sequence is slow, so run it for all units in parallel */
+	if (martin_num == 1) {
+		setup_error[0] = usb_martin_setup(martin_dev[0]);
+	} else {
+		pthread_t setup[MAX_DEVICES];
+
+		for (unsigned x = 0; x != martin_num; x++)
+			pthread_create(&setup[x], NULL, &usb_martin_setup_thread, martin_dev[x]);
+		for (unsigned x = 0; x != martin_num; x++) {
+			void *retval;
+
+			pthread_join(setup[x], &retval);
+			setup_error[x] = (intptr_t)retval;
+		}
+	}
+
+	/* the event loop closes failed units, and hot plug retries them */
+	for (unsigned x = 0; x != martin_num; x++) {
+		struct martin_dev *dev = martin_dev[x];
+
+		if (setup_error[x] == 0)
+			continue;
+		printf("USB SETUP FAILED ON UNIT %u\n", x);
+		pthread_mutex_lock(&dev->tx_mtx);
+		dev->tx_attached = 0;
+		pthread_mutex_unlock(&dev->tx_mtx);
+		dev->state = UNIT_CLOSING;
+	}
+
+	for (int x = 0; x != NET_MAX; x++) {
+		if (net_universe[x] >= 0)
+			net_open(x);
+	}
+
+	/* also faults in the image, so that rendering never waits for the disk */
+	if (rt_mlock && mlockall(MCL_CURRENT | MCL_FUTURE) != 0)
+		printf("Cannot lock memory, continuing unlocked\n");
+
+	frame_join.num = martin_num;
+
+	for (unsigned x = 0; x != martin_num; x++) {
+		if (setup_error[x] == 0 && usb_rx_start(martin_dev[x]) != 0)
+			printf("USB READ FAILED ON UNIT %u\n", x);
+		if (replay_file != NULL)
+			continue;
+		rt_writer_start(martin_dev[x]);
+
+		if (universes != NULL) {
+			pthread_t thread;
+
+			if (pthread_create(&thread, NULL, &universe_wait_loop, martin_dev[x]) != 0)
+				errx(1, "Cannot create the universe thread of unit %u", x);
+		}
+	}
+
+	if (replay_file != NULL || record_file != NULL) {
+		pthread_t thread;
+
+		if (pthread_create(&thread, NULL, replay_file != NULL ?
+		    &replay_loop : &record_loop, NULL) != 0)
+			errx(1, "Cannot create the %s thread",
+			    replay_file != NULL ? "replay" : "recorder");
+	}
 
-	alsa_read_loop(NULL);
+	rt_pin(pthread_self(), rt_cpu_event, "event loop");
+	event_loop();
 
 	return (0);
 }
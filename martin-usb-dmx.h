@@ -0,0 +1,108 @@
+/*-
+ * Copyright (c) 2022 Hans Petter Selasky. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#ifndef _MARTIN_USB_DMX_H_
+#define	_MARTIN_USB_DMX_H_
+
+/*
+ * This file describes the shared memory objects exported by
+ * martin-usb-dmx, for use by monitoring and other client programs.
+ */
+#include <stdint.h>
+#include <stdatomic.h>
+#include <semaphore.h>
+
+/*
+ * Statistics page, exported with the -m option. Map it read only and
+ * check the magic first. Every counter has a single writer thread and
+ * is updated with relaxed atomic stores, so readers see each value
+ * whole, but not necessarily in step with the other values.
+ */
+#define	MARTIN_STATS_MAGIC 0x4d535431U	/* "MST1" */
+#define	MARTIN_STATS_UNITS 16
+#define	MARTIN_STATS_HIST 16
+
+/*
+ * Bucket 0 of a latency histogram counts values below one microsecond
+ * and bucket N counts values from 2**(N-1) up to 2**N microseconds.
+ * The last bucket also counts everything above.
+ */
+struct martin_stats_unit {
+	_Atomic uint64_t frames;	/* submitted to the bus */
+	_Atomic uint64_t missed;	/* frame deadlines */
+	_Atomic uint64_t dropped;	/* frames, bus still busy */
+	_Atomic uint64_t tx_errors;
+	_Atomic uint64_t setup_retries;
+	_Atomic uint64_t input_events;	/* MIDI, panel and network */
+	_Atomic uint64_t input_dropped;	/* notes, trigger queue full */
+	_Atomic uint32_t fps_milli;	/* achieved rate, once a second */
+	_Atomic uint32_t fps_target_milli;	/* adapted to the bus */
+	_Atomic uint64_t tx_latency[MARTIN_STATS_HIST];	/* submit to completion */
+	_Atomic uint64_t event_latency[MARTIN_STATS_HIST];	/* input event to completion */
+};
+
+struct martin_stats {
+	uint32_t magic;
+	uint32_t units;			/* in use */
+	uint64_t start;			/* CLOCK_MONOTONIC, ns */
+	struct martin_stats_unit unit[MARTIN_STATS_UNITS];
+};
+
+/*
+ * Universe page, created with the -U option. Other processes map it
+ * read-write and write DMX data straight into it, one producer per
+ * universe. A frame is published like this:
+ *
+ *	seq = atomic_load(&u->seq);
+ *	atomic_store_explicit(&u->seq, seq + 1, memory_order_relaxed);
+ *	atomic_thread_fence(memory_order_release);
+ *	memcpy(u->data, frame, MARTIN_UNIVERSE_SLOTS);
+ *	atomic_store_explicit(&u->seq, seq + 2, memory_order_release);
+ *	sem_post(&u->ready);
+ *
+ * The next DMX frame of the unit picks it up, and in immediate mode
+ * "ready" sends it right away. The data is merged with the other
+ * sources while "active" is set, so a producer clears it when done.
+ * Posting "ready" is optional, and EOVERFLOW from sem_post() can be
+ * ignored.
+ */
+#define	MARTIN_UNIVERSE_MAGIC 0x4d554e31U	/* "MUN1" */
+#define	MARTIN_UNIVERSE_UNITS 16
+#define	MARTIN_UNIVERSE_SLOTS 512
+
+struct martin_universe {
+	_Atomic uint32_t seq;		/* odd while the producer writes */
+	_Atomic uint32_t active;	/* non-zero to take part in the merge */
+	sem_t	ready;			/* process shared */
+	uint8_t	data[MARTIN_UNIVERSE_SLOTS];
+};
+
+struct martin_universes {
+	uint32_t magic;
+	uint32_t units;			/* in use */
+	struct martin_universe unit[MARTIN_UNIVERSE_UNITS];
+};
+
+#endif					/* _MARTIN_USB_DMX_H_ */
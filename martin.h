@@ -1,1705 +0,0 @@
-/*-
- * Copyright (c) 2022 Hans Petter Selasky. All rights reserved.
- *
- * Redistribution and use in source and binary forms, with or without
- * modification, are permitted provided that the following conditions
- * are met:
- * 1. Redistributions of source code must retain the above copyright
- *    notice, this list of conditions and the following disclaimer.
- * 2. Redistributions in binary form must reproduce the above copyright
- *    notice, this list of conditions and the following disclaimer in the
- *    documentation and/or other materials provided with the distribution.
- *
- * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
- * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
- * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
- * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
- * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
- * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
- * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
- * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
- * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
- * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
- * SUCH DAMAGE.
- */
-
-/* Init sequence */
-
-struct setup_request  {
-	uint8_t bmRequestType;
-	uint8_t bRequest;
-	uint16_t wValue;
-	uint16_t wIndex;
-	uint16_t wLength;
-	uint16_t cbData;
-	char *pData;
-};
-
-struct setup_request s_setupRequest[] = 
-{
-	{
-		0x80, 0x06, 0x0300, 0x0000, 0x00FF, 0x0004, "\x04\x03\x09\x04"
-	}, 
-	{
-		0x80, 0x06, 0x0301, 0x0409, 0x00FF, 0x0028, "\x28\x03\x4D\x00\x61\x00\x72\x00\x74\x00\x69\x00\x6E\x00\x20\x00\x50\x00\x72\x00\x6F\x00\x66\x00\x65\x00\x73\x00\x73\x00\x69\x00\x6F\x00\x6E\x00\x61\x00\x6C\x00"
-	}, 
-	{
-		0x80, 0x06, 0x0302, 0x0409, 0x00FF, 0x0010, "\x10\x03\x4D\x00\x2D\x00\x54\x00\x6F\x00\x75\x00\x63\x00\x68\x00"
-	}, 
-	{
-		0x80, 0x06, 0x0100, 0x0000, 0x0012, 0x0012, "\x12\x01\x10\x01\x00\x00\x00\x40\xBE\x11\x08\xF8\x06\x02\x01\x02\x00\x01"
-	}, 
-	{
-		0xC0, 0x00, 0x0000, 0x0000, 0x0010, 0x0010, "\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF"
-	}, 
-	{
-		0x40, 0x32, 0x0000, 0x0000, 0x0020, 0x0020, "\x41\x20\x7C\x18\xE3\x1D\xBB\x27\x12\x38\x32\x15\x38\x3D\xEB\x0B\x7D\x46\x60\xC2\xCE\xC6\x03\x01\xFE\x4B\x93\xC0\x01\xEB\x85\x0F"
-	}, 
-	{
-		0xC0, 0x32, 0x0000, 0x0000, 0x0020, 0x0020, "\x1B\x25\x68\xFD\xEA\xD9\x8C\x0B\x2B\x8A\xDC\x95\xDA\x68\x72\x0A\x2C\x20\x37\x77\x9F\x51\x11\x2F\x4C\xEF\x15\x10\xBE\xFE\xDD\x95"
-	}, 
-	{
-		0x40, 0x40, 0x0000, 0x0010, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x41, 0x0001, 0x0000, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x80, 0x06, 0x0100, 0x0000, 0x0012, 0x0012, "\x12\x01\x10\x01\x00\x00\x00\x40\xBE\x11\x08\xF8\x06\x02\x01\x02\x00\x01"
-	}, 
-	{
-		0xC0, 0x01, 0x0000, 0x0000, 0x0010, 0x0010, "\xFF\xFF\xA4\x5B\x00\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF"
-	}, 
-	{
-		0x40, 0x80, 0x004E, 0x7110, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x80, 0x06, 0x0100, 0x0000, 0x0012, 0x0012, "\x12\x01\x10\x01\x00\x00\x00\x40\xBE\x11\x08\xF8\x06\x02\x01\x02\x00\x01"
-	}, 
-	{
-		0xC0, 0x01, 0x0000, 0x0000, 0x0010, 0x0010, "\xFF\xFF\xA4\x5B\x00\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF"
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5511, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5512, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5513, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5502, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5503, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5504, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x80, 0x06, 0x0100, 0x0000, 0x0012, 0x0012, "\x12\x01\x10\x01\x00\x00\x00\x40\xBE\x11\x08\xF8\x06\x02\x01\x02\x00\x01"
-	}, 
-	{
-		0xC0, 0x01, 0x0000, 0x0000, 0x0010, 0x0010, "\xFF\xFF\xA4\x5B\x00\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6122, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6122, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5801, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5802, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x6401, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5803, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5411, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x6402, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5804, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5801, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5805, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5802, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5806, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5803, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5807, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5804, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5808, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x6121, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5805, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5809, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6122, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6122, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5806, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x580A, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5807, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5808, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5809, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x580A, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5101, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x6131, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6132, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6132, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5103, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0103, 0x5812, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5813, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5801, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5804, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5801, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5806, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5809, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5814, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5802, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5805, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x80, 0x06, 0x0100, 0x0000, 0x0012, 0x0012, "\x12\x01\x10\x01\x00\x00\x00\x40\xBE\x11\x08\xF8\x06\x02\x01\x02\x00\x01"
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5802, 0x0000, 0x0000, ""
-	}, 
-	{
-		0xC0, 0x01, 0x0000, 0x0000, 0x0010, 0x0010, "\xFF\xFF\xA4\x5B\x00\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF"
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x6131, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5807, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x580A, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5815, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5803, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5803, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5808, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6132, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6132, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5804, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5805, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5806, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5807, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5808, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5809, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x6141, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x580A, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6142, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6142, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x6111, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0xC0, 0x01, 0x0000, 0x0000, 0x0010, 0x0010, "\xFF\xFF\xA4\x5B\x00\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF"
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x6001, 0x0000, 0x0000, ""
-	}, 
-	{
-		0xC0, 0x01, 0x0000, 0x0000, 0x0010, 0x0010, "\xFF\xFF\xA4\x5B\x00\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF"
-	}, 
-	{
-		0xC0, 0x01, 0x0000, 0x0000, 0x0010, 0x0010, "\xFF\xFF\xA4\x5B\x00\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF"
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x6141, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5401, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6142, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6142, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5402, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x6111, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x6121, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x4275, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x4241, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5807, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0103, 0x4242, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x4243, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x4243, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5801, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5802, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x4245, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5803, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x4211, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5801, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5804, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0103, 0x4212, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5805, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x4213, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x4213, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5806, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5807, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x4215, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5808, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5809, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x4281, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5809, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x580A, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x4282, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x4283, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x4283, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x4285, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x4251, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5803, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0103, 0x4252, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x4253, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x4253, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x4255, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x4221, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5806, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0103, 0x4222, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x4223, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x4223, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x54, 0x0000, 0x4401, 0x0006, 0x0006, "\x00\x17\x06\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x4225, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x4291, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5805, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x4292, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x4293, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x4293, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x4295, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x4261, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5808, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0103, 0x4262, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x4263, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x4263, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x4265, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x4231, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5802, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0103, 0x4232, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x4233, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x4233, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x4235, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x4201, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x4202, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x580A, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x4203, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x4203, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x4205, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x4271, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5804, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0103, 0x4272, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x4273, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x4273, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5804, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5808, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5803, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5807, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x17, 0x0000, 0x2000, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5802, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5806, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5801, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x580A, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5805, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5809, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5807, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5801, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5802, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5803, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5801, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5804, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5805, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5806, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5807, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5808, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5809, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5809, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x580A, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5803, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5806, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5805, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5808, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5802, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x580A, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5804, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0103, 0x5812, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5813, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5814, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5815, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5103, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5103, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x5103, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0103, 0x6111, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x01\x00\x00\x01\x00\x00\x01\x00\x00"
-	}, 
-	{
-		0x40, 0x80, 0x0103, 0x5103, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x01\x00\x00\x01\x00\x00\x01\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x01\x00\x00\x01\x00\x00\x01\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x03\x00\x00\x03\x00\x00\x03\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x03\x00\x00\x03\x00\x00\x03\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x03\x00\x00\x03\x00\x00\x03\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x03\x00\x00\x03\x00\x00\x03\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x03\x00\x00\x03\x00\x00\x03\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x03\x00\x00\x03\x00\x00\x03\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x03\x00\x00\x03\x00\x00\x03\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x03\x00\x00\x03\x00\x00\x03\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x03\x00\x00\x03\x00\x00\x03\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x03\x00\x00\x03\x00\x00\x03\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x03\x00\x00\x03\x00\x00\x03\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x03\x00\x00\x03\x00\x00\x03\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x03\x00\x00\x03\x00\x00\x03\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x03\x00\x00\x03\x00\x00\x03\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x03\x00\x00\x03\x00\x00\x03\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x03\x00\x00\x03\x00\x00\x03\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x03\x00\x00\x03\x00\x00\x03\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x03\x00\x00\x03\x00\x00\x03\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x07\x00\x00\x07\x00\x00\x07\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x07\x00\x00\x07\x00\x00\x07\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x07\x00\x00\x07\x00\x00\x07\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x07\x00\x00\x07\x00\x00\x07\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x07\x00\x00\x07\x00\x00\x07\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x07\x00\x00\x07\x00\x00\x07\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x07\x00\x00\x07\x00\x00\x07\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x07\x00\x00\x07\x00\x00\x07\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x07\x00\x00\x07\x00\x00\x07\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x07\x00\x00\x07\x00\x00\x07\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x07\x00\x00\x07\x00\x00\x07\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x07\x00\x00\x07\x00\x00\x07\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x07\x00\x00\x07\x00\x00\x07\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x07\x00\x00\x07\x00\x00\x07\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x07\x00\x00\x07\x00\x00\x07\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x07\x00\x00\x07\x00\x00\x07\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x07\x00\x00\x07\x00\x00\x07\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x0F\x00\x00\x0F\x00\x00\x0F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x0F\x00\x00\x0F\x00\x00\x0F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x0F\x00\x00\x0F\x00\x00\x0F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x0F\x00\x00\x0F\x00\x00\x0F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x0F\x00\x00\x0F\x00\x00\x0F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x0F\x00\x00\x0F\x00\x00\x0F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x0F\x00\x00\x0F\x00\x00\x0F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x0F\x00\x00\x0F\x00\x00\x0F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x0F\x00\x00\x0F\x00\x00\x0F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x0F\x00\x00\x0F\x00\x00\x0F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x0F\x00\x00\x0F\x00\x00\x0F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x0F\x00\x00\x0F\x00\x00\x0F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x0F\x00\x00\x0F\x00\x00\x0F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x0F\x00\x00\x0F\x00\x00\x0F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x0F\x00\x00\x0F\x00\x00\x0F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x0F\x00\x00\x0F\x00\x00\x0F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x0F\x00\x00\x0F\x00\x00\x0F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x0F\x00\x00\x0F\x00\x00\x0F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x0F\x00\x00\x0F\x00\x00\x0F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x0F\x00\x00\x0F\x00\x00\x0F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x0F\x00\x00\x0F\x00\x00\x0F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x07\x00\x00\x07\x00\x00\x07\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x07\x00\x00\x07\x00\x00\x07\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x07\x00\x00\x07\x00\x00\x07\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x07\x00\x00\x07\x00\x00\x07\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x07\x00\x00\x07\x00\x00\x07\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x07\x00\x00\x07\x00\x00\x07\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x07\x00\x00\x07\x00\x00\x07\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x07\x00\x00\x07\x00\x00\x07\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x03\x00\x00\x03\x00\x00\x03\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x03\x00\x00\x03\x00\x00\x03\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x03\x00\x00\x03\x00\x00\x03\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x03\x00\x00\x03\x00\x00\x03\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x03\x00\x00\x03\x00\x00\x03\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x03\x00\x00\x03\x00\x00\x03\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x03\x00\x00\x03\x00\x00\x03\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x03\x00\x00\x03\x00\x00\x03\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x01\x00\x00\x01\x00\x00\x01\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x01\x00\x00\x01\x00\x00\x01\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x01\x00\x00\x01\x00\x00\x01\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x01\x00\x00\x01\x00\x00\x01\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x01\x00\x00\x01\x00\x00\x01\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x01\x00\x00\x01\x00\x00\x01\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x80, 0x0103, 0x5103, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0103, 0x5103, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0103, 0x5103, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x01\x00\x00\x01\x00\x00\x01\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x80, 0x0103, 0x5103, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x01\x00\x00\x01\x00\x00\x01\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x01\x00\x00\x01\x00\x00\x01\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x01\x00\x00\x01\x00\x00\x01\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x01\x00\x00\x01\x00\x00\x01\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x03\x00\x00\x03\x00\x00\x03\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x03\x00\x00\x03\x00\x00\x03\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x03\x00\x00\x03\x00\x00\x03\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x03\x00\x00\x03\x00\x00\x03\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x03\x00\x00\x03\x00\x00\x03\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x03\x00\x00\x03\x00\x00\x03\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x03\x00\x00\x03\x00\x00\x03\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x03\x00\x00\x03\x00\x00\x03\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x03\x00\x00\x03\x00\x00\x03\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x03\x00\x00\x03\x00\x00\x03\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x03\x00\x00\x03\x00\x00\x03\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x03\x00\x00\x03\x00\x00\x03\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x03\x00\x00\x03\x00\x00\x03\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x03\x00\x00\x03\x00\x00\x03\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x03\x00\x00\x03\x00\x00\x03\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x07\x00\x00\x07\x00\x00\x07\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x07\x00\x00\x07\x00\x00\x07\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x07\x00\x00\x07\x00\x00\x07\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x07\x00\x00\x07\x00\x00\x07\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x07\x00\x00\x07\x00\x00\x07\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x07\x00\x00\x07\x00\x00\x07\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x07\x00\x00\x07\x00\x00\x07\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x07\x00\x00\x07\x00\x00\x07\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x07\x00\x00\x07\x00\x00\x07\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x07\x00\x00\x07\x00\x00\x07\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x07\x00\x00\x07\x00\x00\x07\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x07\x00\x00\x07\x00\x00\x07\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x07\x00\x00\x07\x00\x00\x07\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x07\x00\x00\x07\x00\x00\x07\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x07\x00\x00\x07\x00\x00\x07\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x07\x00\x00\x07\x00\x00\x07\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x07\x00\x00\x07\x00\x00\x07\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x07\x00\x00\x07\x00\x00\x07\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x0F\x00\x00\x0F\x00\x00\x0F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x0F\x00\x00\x0F\x00\x00\x0F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x0F\x00\x00\x0F\x00\x00\x0F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x0F\x00\x00\x0F\x00\x00\x0F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x0F\x00\x00\x0F\x00\x00\x0F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x0F\x00\x00\x0F\x00\x00\x0F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x0F\x00\x00\x0F\x00\x00\x0F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x0F\x00\x00\x0F\x00\x00\x0F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x0F\x00\x00\x0F\x00\x00\x0F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x0F\x00\x00\x0F\x00\x00\x0F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x0F\x00\x00\x0F\x00\x00\x0F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x0F\x00\x00\x0F\x00\x00\x0F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x0F\x00\x00\x0F\x00\x00\x0F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x0F\x00\x00\x0F\x00\x00\x0F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x0F\x00\x00\x0F\x00\x00\x0F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x0F\x00\x00\x0F\x00\x00\x0F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x0F\x00\x00\x0F\x00\x00\x0F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x0F\x00\x00\x0F\x00\x00\x0F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x1F\x00\x00\x1F\x00\x00\x1F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x1F\x00\x00\x1F\x00\x00\x1F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x1F\x00\x00\x1F\x00\x00\x1F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x1F\x00\x00\x1F\x00\x00\x1F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x1F\x00\x00\x1F\x00\x00\x1F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x1F\x00\x00\x1F\x00\x00\x1F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x1F\x00\x00\x1F\x00\x00\x1F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x1F\x00\x00\x1F\x00\x00\x1F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x1F\x00\x00\x1F\x00\x00\x1F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x1F\x00\x00\x1F\x00\x00\x1F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x1F\x00\x00\x1F\x00\x00\x1F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x0F\x00\x00\x0F\x00\x00\x0F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x0F\x00\x00\x0F\x00\x00\x0F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x0F\x00\x00\x0F\x00\x00\x0F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x0F\x00\x00\x0F\x00\x00\x0F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x0F\x00\x00\x0F\x00\x00\x0F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x0F\x00\x00\x0F\x00\x00\x0F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x0F\x00\x00\x0F\x00\x00\x0F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x07\x00\x00\x07\x00\x00\x07\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x07\x00\x00\x07\x00\x00\x07\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x07\x00\x00\x07\x00\x00\x07\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x07\x00\x00\x07\x00\x00\x07\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x07\x00\x00\x07\x00\x00\x07\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x07\x00\x00\x07\x00\x00\x07\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x07\x00\x00\x07\x00\x00\x07\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x07\x00\x00\x07\x00\x00\x07\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x07\x00\x00\x07\x00\x00\x07\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x03\x00\x00\x03\x00\x00\x03\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x03\x00\x00\x03\x00\x00\x03\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x03\x00\x00\x03\x00\x00\x03\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x03\x00\x00\x03\x00\x00\x03\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x03\x00\x00\x03\x00\x00\x03\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x03\x00\x00\x03\x00\x00\x03\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x03\x00\x00\x03\x00\x00\x03\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x03\x00\x00\x03\x00\x00\x03\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x01\x00\x00\x01\x00\x00\x01\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x01\x00\x00\x01\x00\x00\x01\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x01\x00\x00\x01\x00\x00\x01\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6122, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6122, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x6121, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6122, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6122, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x6131, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6132, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6132, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x6131, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6132, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6132, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x6141, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6142, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6142, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x80, 0x0103, 0x6111, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x6141, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6142, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6142, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x80, 0x0103, 0x6111, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x6121, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6122, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6122, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x6121, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6122, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6122, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x6131, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6132, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6132, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x6131, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6132, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6132, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x6141, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6142, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6142, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x80, 0x0103, 0x6111, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x01\x00\x00\x01\x00\x00\x01\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x01\x00\x00\x01\x00\x00\x01\x00\x00"
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x6141, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6142, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6142, 0x0009, 0x0009, "\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-	}, 
-	{
-		0x40, 0x80, 0x0103, 0x6111, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x01\x00\x00\x01\x00\x00\x01\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x01\x00\x00\x01\x00\x00\x01\x00\x00"
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x6121, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\xFF\x03\x00\xFF\x03\x00\xFF\x03\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6122, 0x0009, 0x0009, "\xFF\x03\x00\xFF\x03\x00\xFF\x03\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6132, 0x0009, 0x0009, "\xFF\x03\x00\xFF\x03\x00\xFF\x03\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\xFF\x01\x00\xFF\x01\x00\xFF\x01\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\xFF\x00\x00\xFF\x00\x00\xFF\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\xFF\x00\x00\xFF\x00\x00\xFF\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\xFF\x00\x00\xFF\x00\x00\xFF\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\xFF\x00\x00\xFF\x00\x00\xFF\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x7F\x00\x00\x7F\x00\x00\x7F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x7F\x00\x00\x7F\x00\x00\x7F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x7F\x00\x00\x7F\x00\x00\x7F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x7F\x00\x00\x7F\x00\x00\x7F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x7F\x00\x00\x7F\x00\x00\x7F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x3F\x00\x00\x3F\x00\x00\x3F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x3F\x00\x00\x3F\x00\x00\x3F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x3F\x00\x00\x3F\x00\x00\x3F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x3F\x00\x00\x3F\x00\x00\x3F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x3F\x00\x00\x3F\x00\x00\x3F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x3F\x00\x00\x3F\x00\x00\x3F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x1F\x00\x00\x1F\x00\x00\x1F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x1F\x00\x00\x1F\x00\x00\x1F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x1F\x00\x00\x1F\x00\x00\x1F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x1F\x00\x00\x1F\x00\x00\x1F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x0F\x00\x00\x0F\x00\x00\x0F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x0F\x00\x00\x0F\x00\x00\x0F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x0F\x00\x00\x0F\x00\x00\x0F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x0F\x00\x00\x0F\x00\x00\x0F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x0F\x00\x00\x0F\x00\x00\x0F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x07\x00\x00\x07\x00\x00\x07\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x07\x00\x00\x07\x00\x00\x07\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x07\x00\x00\x07\x00\x00\x07\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x07\x00\x00\x07\x00\x00\x07\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x07\x00\x00\x07\x00\x00\x07\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x07\x00\x00\x07\x00\x00\x07\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x0F\x00\x00\x0F\x00\x00\x0F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x0F\x00\x00\x0F\x00\x00\x0F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x1F\x00\x00\x1F\x00\x00\x1F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x1F\x00\x00\x1F\x00\x00\x1F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x1F\x00\x00\x1F\x00\x00\x1F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x3F\x00\x00\x3F\x00\x00\x3F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x3F\x00\x00\x3F\x00\x00\x3F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x3F\x00\x00\x3F\x00\x00\x3F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x3F\x00\x00\x3F\x00\x00\x3F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x7F\x00\x00\x7F\x00\x00\x7F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x7F\x00\x00\x7F\x00\x00\x7F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x7F\x00\x00\x7F\x00\x00\x7F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x7F\x00\x00\x7F\x00\x00\x7F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\x7F\x00\x00\x7F\x00\x00\x7F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\xFF\x00\x00\xFF\x00\x00\xFF\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\xFF\x00\x00\xFF\x00\x00\xFF\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\xFF\x00\x00\xFF\x00\x00\xFF\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\xFF\x00\x00\xFF\x00\x00\xFF\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\xFF\x00\x00\xFF\x00\x00\xFF\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\xFF\x00\x00\xFF\x00\x00\xFF\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\xFF\x01\x00\xFF\x01\x00\xFF\x01\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\xFF\x01\x00\xFF\x01\x00\xFF\x01\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\xFF\x01\x00\xFF\x01\x00\xFF\x01\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\xFF\x01\x00\xFF\x01\x00\xFF\x01\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\xFF\x01\x00\xFF\x01\x00\xFF\x01\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\xFF\x01\x00\xFF\x01\x00\xFF\x01\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6112, 0x0009, 0x0009, "\xFF\x03\x00\xFF\x03\x00\xFF\x03\x00"
-	}, 
-	{
-		0x40, 0x80, 0x0103, 0x6121, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x6111, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6122, 0x0009, 0x0009, "\xFF\x01\x00\xFF\x01\x00\xFF\x01\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6122, 0x0009, 0x0009, "\xFF\x01\x00\xFF\x01\x00\xFF\x01\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6122, 0x0009, 0x0009, "\xFF\x01\x00\xFF\x01\x00\xFF\x01\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6122, 0x0009, 0x0009, "\xFF\x00\x00\xFF\x00\x00\xFF\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6122, 0x0009, 0x0009, "\xFF\x00\x00\xFF\x00\x00\xFF\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6122, 0x0009, 0x0009, "\xFF\x00\x00\xFF\x00\x00\xFF\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6122, 0x0009, 0x0009, "\x7F\x00\x00\x7F\x00\x00\x7F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6122, 0x0009, 0x0009, "\x7F\x00\x00\x7F\x00\x00\x7F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6122, 0x0009, 0x0009, "\x3F\x00\x00\x3F\x00\x00\x3F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6122, 0x0009, 0x0009, "\x3F\x00\x00\x3F\x00\x00\x3F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6122, 0x0009, 0x0009, "\x3F\x00\x00\x3F\x00\x00\x3F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6122, 0x0009, 0x0009, "\x3F\x00\x00\x3F\x00\x00\x3F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6122, 0x0009, 0x0009, "\x3F\x00\x00\x3F\x00\x00\x3F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6122, 0x0009, 0x0009, "\x3F\x00\x00\x3F\x00\x00\x3F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6122, 0x0009, 0x0009, "\x3F\x00\x00\x3F\x00\x00\x3F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6122, 0x0009, 0x0009, "\x1F\x00\x00\x1F\x00\x00\x1F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6122, 0x0009, 0x0009, "\x1F\x00\x00\x1F\x00\x00\x1F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6122, 0x0009, 0x0009, "\x3F\x00\x00\x3F\x00\x00\x3F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6122, 0x0009, 0x0009, "\x3F\x00\x00\x3F\x00\x00\x3F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6122, 0x0009, 0x0009, "\x7F\x00\x00\x7F\x00\x00\x7F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6122, 0x0009, 0x0009, "\x7F\x00\x00\x7F\x00\x00\x7F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6122, 0x0009, 0x0009, "\x7F\x00\x00\x7F\x00\x00\x7F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6122, 0x0009, 0x0009, "\xFF\x00\x00\xFF\x00\x00\xFF\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6122, 0x0009, 0x0009, "\xFF\x00\x00\xFF\x00\x00\xFF\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6122, 0x0009, 0x0009, "\xFF\x00\x00\xFF\x00\x00\xFF\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6122, 0x0009, 0x0009, "\xFF\x00\x00\xFF\x00\x00\xFF\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6122, 0x0009, 0x0009, "\xFF\x01\x00\xFF\x01\x00\xFF\x01\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6122, 0x0009, 0x0009, "\xFF\x01\x00\xFF\x01\x00\xFF\x01\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6122, 0x0009, 0x0009, "\xFF\x03\x00\xFF\x03\x00\xFF\x03\x00"
-	}, 
-	{
-		0x40, 0x80, 0x0000, 0x6121, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x80, 0x0103, 0x6131, 0x0000, 0x0000, ""
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6132, 0x0009, 0x0009, "\xFF\x01\x00\xFF\x01\x00\xFF\x01\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6132, 0x0009, 0x0009, "\xFF\x00\x00\xFF\x00\x00\xFF\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6132, 0x0009, 0x0009, "\x7F\x00\x00\x7F\x00\x00\x7F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6132, 0x0009, 0x0009, "\x7F\x00\x00\x7F\x00\x00\x7F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6132, 0x0009, 0x0009, "\x7F\x00\x00\x7F\x00\x00\x7F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6132, 0x0009, 0x0009, "\x3F\x00\x00\x3F\x00\x00\x3F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6132, 0x0009, 0x0009, "\x3F\x00\x00\x3F\x00\x00\x3F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6132, 0x0009, 0x0009, "\x3F\x00\x00\x3F\x00\x00\x3F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6132, 0x0009, 0x0009, "\x3F\x00\x00\x3F\x00\x00\x3F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6132, 0x0009, 0x0009, "\x1F\x00\x00\x1F\x00\x00\x1F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6132, 0x0009, 0x0009, "\x3F\x00\x00\x3F\x00\x00\x3F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6132, 0x0009, 0x0009, "\x7F\x00\x00\x7F\x00\x00\x7F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6132, 0x0009, 0x0009, "\x7F\x00\x00\x7F\x00\x00\x7F\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6132, 0x0009, 0x0009, "\xFF\x00\x00\xFF\x00\x00\xFF\x00\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6132, 0x0009, 0x0009, "\xFF\x01\x00\xFF\x01\x00\xFF\x01\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6132, 0x0009, 0x0009, "\xFF\x01\x00\xFF\x01\x00\xFF\x01\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6132, 0x0009, 0x0009, "\xFF\x01\x00\xFF\x01\x00\xFF\x01\x00"
-	}, 
-	{
-		0x40, 0x61, 0x0000, 0x6132, 0x0009, 0x0009, "\xFF\x03\x00\xFF\x03\x00\xFF\x03\x00"
-	}, 
-};